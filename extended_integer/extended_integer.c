@@ -34,47 +34,25 @@
 
 /*!
     @header extended_integer.c
-    @abstract extended_integer is implemented in by uint32_t as basic type, align as little endian
+    @abstract extended_integer is implemented in by EXT_TYPE (uint32_t or uint64_t) as basic type, align as little endian
  */
 
 #include <stdio.h>
+#include <time.h>
 #include <limits.h>
 #include <stdbool.h>
 #include "CFMacro.h"
 #include "extended_integer.h"
+#include "scratch_arena.h"
 
-#define HIGH_BIT(basic_element) ((EXT_TYPE_C(1) << (EXT_BIT - 1)) & ((EXT_TYPE)basic_element))
-
-#ifdef __GNUC__
-#define EXTENDED_INTEGER_TEMP_ALLOC(size) __builtin_alloca(size)
-#else
-#error GNUC compiler missing extended integer may use heap storage  \
-       [ COMMENT THIS ERROR ] if you understand the problem
-#include <stdlib.h>
-#define EXTENDED_INTEGER_TEMP_ALLOC(size) malloc(size)
+// ADCX carry chain with runtime detection, 64 bit limb on x86_64 only
+#if defined EXTENDED_INTEGER_LIMB_64 && defined __GNUC__ && defined __x86_64__
+  #define EXTENDED_INTEGER_CARRY_CHAIN_ADX
+  #include <immintrin.h>
 #endif
 
-#pragma mark - Common Static Decleration
-
-/*!
-   @function extended_integer_query_info
-   @abstract query related info of an extended integer
-   @param length should not be zero
-   @param all_zero if not null, store whether the whole array is zero
-   @param highest_bit_index if not null, store the first bit index that is not zero
-                       this could be non-null only if all_zero is not null
-                       if all_zero is null and this is not null, debug exception raised
-                       if all bit is zero, stored zero for general purpose
-   @param lowest_bit_index if not null, store the first bit index that is not zero
-                       this could be non-null only if all_zero is not null
-                       if all_zero is null and this is not null, debug exception raised
-                       if all bit is zero, stored zero for general purpose
-*/
-static void extended_integer_query_info(EXT_ARRAY _Nonnull restrict array,
-                                        size_t length,
-                                        bool * _Nonnull restrict all_zero,
-                                        size_t * _Nullable restrict highest_bit_index,
-                                        size_t * _Nullable restrict lowest_bit_index);
+// temporary storage from scratch arena, released by scratch_arena_release before return
+#define EXTENDED_INTEGER_TEMP_ALLOC(size) scratch_arena_alloc(size)
 
 #pragma mark - Inline Static Decleration
 
@@ -104,6 +82,100 @@ static inline void extended_integer_inline_bit_offset(EXT_ARRAY _Nonnull restric
 
 static void inline extended_integer_inline_all_zero(EXT_ARRAY _Nonnull array, size_t length);
 
+/*!
+    @function extended_integer_inline_used_length
+    @return element amount up to the highest non-zero element, zero if all zero
+ */
+static inline size_t extended_integer_inline_used_length(EXT_ARRAY _Nonnull array, size_t length);
+
+/*!
+    @function extended_integer_inline_leading_zero
+    @param value should not be zero
+ */
+static inline unsigned int extended_integer_inline_leading_zero(EXT_TYPE value);
+
+/*!
+    @function extended_integer_inline_bit_length
+    @return highest bit index plus one, zero if all zero
+ */
+static inline size_t extended_integer_inline_bit_length(EXT_ARRAY _Nonnull array, size_t length);
+
+/*!
+    @function extended_integer_inline_window
+    @return 64 bit begin at bit_index, bits beyond length are zero
+ */
+static inline uint64_t extended_integer_inline_window(EXT_ARRAY _Nonnull array, size_t length, size_t bit_index);
+
+#pragma mark - Multiply Static Decleration
+
+/*!
+    @function extended_integer_schoolbook_product
+    @abstract product = parm1 x parm2
+    @param product parm1_length + parm2_length elements, lengths should not be zero
+ */
+static void extended_integer_schoolbook_product(EXT_ARRAY _Nonnull parm1,
+                                                size_t parm1_length,
+                                                EXT_ARRAY _Nonnull parm2,
+                                                size_t parm2_length,
+                                                EXT_ARRAY _Nonnull restrict product);
+
+/*!
+    @function extended_integer_karatsuba_product
+    @abstract product = parm1 x parm2
+    @param product parm1_length + parm2_length elements, lengths should not be zero
+    @param threshold operands shorter than it are multiplied by schoolbook
+    @return false if scratch arena is full, product is undefined
+ */
+static bool extended_integer_karatsuba_product(EXT_ARRAY _Nonnull parm1,
+                                               size_t parm1_length,
+                                               EXT_ARRAY _Nonnull parm2,
+                                               size_t parm2_length,
+                                               EXT_ARRAY _Nonnull restrict product,
+                                               size_t threshold);
+
+#pragma mark - Carry Chain Static Decleration
+
+/*!
+    @typedef extended_integer_carry_chain_func_t
+    @abstract result = parm1 + parm2 or parm1 - parm2 over length elements, length should not be zero
+    @return carry or borrow out of the most significand element
+ */
+typedef bool (*extended_integer_carry_chain_func_t)(EXT_ARRAY _Nonnull parm1,
+                                                    EXT_ARRAY _Nonnull parm2,
+                                                    EXT_ARRAY _Nonnull restrict result,
+                                                    size_t length);
+
+static bool extended_integer_carry_add_portable(EXT_ARRAY _Nonnull parm1,
+                                                EXT_ARRAY _Nonnull parm2,
+                                                EXT_ARRAY _Nonnull restrict result,
+                                                size_t length);
+
+static bool extended_integer_carry_sbtract_portable(EXT_ARRAY _Nonnull parm1,
+                                                    EXT_ARRAY _Nonnull parm2,
+                                                    EXT_ARRAY _Nonnull restrict result,
+                                                    size_t length);
+
+/*!
+    @function extended_integer_carry_add_dispatch
+    @abstract picks the carry chain kernels for this CPU on first call, then adds through the pick
+ */
+static bool extended_integer_carry_add_dispatch(EXT_ARRAY _Nonnull parm1,
+                                                EXT_ARRAY _Nonnull parm2,
+                                                EXT_ARRAY _Nonnull restrict result,
+                                                size_t length);
+
+/*!
+    @function extended_integer_carry_sbtract_dispatch
+    @abstract picks the carry chain kernels for this CPU on first call, then subtracts through the pick
+ */
+static bool extended_integer_carry_sbtract_dispatch(EXT_ARRAY _Nonnull parm1,
+                                                    EXT_ARRAY _Nonnull parm2,
+                                                    EXT_ARRAY _Nonnull restrict result,
+                                                    size_t length);
+
+static extended_integer_carry_chain_func_t extended_integer_carry_add = extended_integer_carry_add_dispatch;
+static extended_integer_carry_chain_func_t extended_integer_carry_sbtract = extended_integer_carry_sbtract_dispatch;
+
 #pragma mark - Basic Operation
 
 void extended_integer_initialize(EXT_ARRAY _Nonnull array, size_t length) {
@@ -132,48 +204,26 @@ void extended_integer_copy(EXT_ARRAY _Nonnull restrict array,
     } DEBUG_ELSE
 }
 
-#pragma mark - Standard Operation
+size_t extended_integer_used_length(EXT_ARRAY _Nonnull array,
+                                    size_t length) {
+    return extended_integer_inline_used_length(array, length);
+}
 
-/*!
-    @function basic_type_promotion_add_inline
-    @param promotion input if promotion from lower array element, output if promoted to next significand array element
-    @return parm1 + parm2
- */
-static inline EXT_TYPE basic_type_promotion_add_inline(EXT_TYPE parm1,
-                                                       EXT_TYPE parm2,
-                                                       bool * _Nonnull promotion) {
-    if(promotion != NULL) {
-        bool pre_promotion = promotion[0];
-        EXT_TYPE remain = EXT_MAX - parm1;
-        if(pre_promotion) {
-            if(parm2 >= remain) promotion[0] = true;
-            else promotion[0] = false;
-        }
-        else {
-            if(parm2 > remain) promotion[0] = true;
-            else promotion[0] = false;
-        }
-        return parm1 + parm2 + (pre_promotion ? EXT_TYPE_C(1) : EXT_TYPE_C(0));
-    } DEBUG_ELSE
-    return 0;
+size_t extended_integer_bit_length(EXT_ARRAY _Nonnull array,
+                                   size_t length) {
+    return extended_integer_inline_bit_length(array, length);
 }
 
+#pragma mark - Standard Operation
+
 void extended_integer_add(EXT_ARRAY _Nonnull parm1,
                           EXT_ARRAY _Nonnull parm2,
                           EXT_ARRAY _Nonnull restrict result,
                           size_t length,
                           bool * _Nullable overflow) {
     if(parm1 != NULL && parm2 != NULL && result != NULL && length > 0) {
-        bool promotion = false;
-        for(size_t index = 0; index < length; index++) {
-            if(HIGH_BIT(parm1[index]) || HIGH_BIT(parm2[index]))
-                result[index] = basic_type_promotion_add_inline(parm1[index], parm2[index], &promotion);
-            else {
-                result[index] = parm1[index] + parm2[index] + (promotion ? EXT_TYPE_C(1) : EXT_TYPE_C(0));
-                promotion = false;
-            }
-        }
-        if(overflow != NULL) overflow[0] = promotion;
+        bool carry = __atomic_load_n(&extended_integer_carry_add, __ATOMIC_RELAXED)(parm1, parm2, result, length);
+        if(overflow != NULL) overflow[0] = carry;
     } DEBUG_ELSE
 }
 
@@ -183,29 +233,10 @@ void extended_integer_sbtract(EXT_ARRAY _Nonnull parm1,
                               size_t length,
                               bool * _Nullable downflow) {
     if(parm1 != NULL && parm2 != NULL && result != NULL && length > 0) {
-        int compare_result = extended_integer_compare(parm1, parm2, length);
-        if(compare_result > 0) {
-            bool borrow = false;
-            for(size_t index = 0; index < length; index++) {
-                if(borrow ? parm1[index] <= parm2[index] : parm1[index] < parm2[index]) {
-                    // parm1 + ((MAX + 1) - parm2) - borrow
-                    result[index] = parm1[index] + (EXT_MAX - parm2[index]) + (borrow ? EXT_TYPE_C(0) : EXT_TYPE_C(1));
-                    borrow = true;
-                }
-                else {
-                    result[index] = parm1[index] - parm2[index] - (borrow ? EXT_TYPE_C(1) : EXT_TYPE_C(0));
-                    borrow = false;
-                }
-            }
-            DEBUG_ASSERT(!borrow);
-            if(downflow != NULL) downflow[0] = false;
-        } else {
-            extended_integer_inline_all_zero(result, length);
-            if(downflow != NULL) {
-                if(compare_result == 0) downflow[0] = false;
-                else downflow[0] = true;
-            }
-        }
+        // borrow out of the top element means parm1 < parm2, equal operands leave zero already
+        bool borrow = __atomic_load_n(&extended_integer_carry_sbtract, __ATOMIC_RELAXED)(parm1, parm2, result, length);
+        if(borrow) extended_integer_inline_all_zero(result, length);
+        if(downflow != NULL) downflow[0] = borrow;
     } DEBUG_ELSE
 }
 
@@ -221,32 +252,46 @@ void extended_integer_multiply(EXT_ARRAY _Nonnull parm1,
         // anyway to all zero result
         extended_integer_inline_all_zero(result, length);
         
-        bool parm1_all_zero;
-        size_t parm1_highest_bit_index;
-        extended_integer_query_info(parm1, length, &parm1_all_zero, &parm1_highest_bit_index, NULL);
-        if(parm1_all_zero) goto LABLE_QUICK_FINISH;
-        
-        bool parm2_all_zero;
-        size_t parm2_highest_bit_index;
-        size_t parm2_lowest_bit_index;
-        extended_integer_query_info(parm2, length, &parm2_all_zero, &parm2_highest_bit_index, &parm2_lowest_bit_index);
-        if(parm2_all_zero) goto LABLE_QUICK_FINISH;
-        DEBUG_ASSERT(parm2_lowest_bit_index <= parm2_highest_bit_index);
-        
-        size_t parm1_overflow_least_offset = (EXT_BIT * length) - parm1_highest_bit_index;
+        size_t parm1_used_length = extended_integer_inline_used_length(parm1, length);
+        size_t parm2_used_length = extended_integer_inline_used_length(parm2, length);
         
-        EXT_ARRAY offseted_parm1 = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
-        EXT_ARRAY pre_saved_result = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
-        
-        if(parm2_highest_bit_index >= parm1_overflow_least_offset) is_overflow = true;
+        if(parm1_used_length >= EXTENDED_INTEGER_KARATSUBA_THRESHOLD &&
+           parm2_used_length >= EXTENDED_INTEGER_KARATSUBA_THRESHOLD) {
+            // full product first, elements beyond length are overflow
+            size_t product_length = parm1_used_length + parm2_used_length;
+            size_t scratch_mark = scratch_arena_mark();
+            EXT_ARRAY product = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * product_length);
+            if(product != NULL &&
+               extended_integer_karatsuba_product(parm1, parm1_used_length, parm2, parm2_used_length,
+                                                  product, EXTENDED_INTEGER_KARATSUBA_THRESHOLD)) {
+                for(size_t index = 0; index < product_length; index++) {
+                    if(index < length) result[index] = product[index];
+                    else if(product[index] != 0) is_overflow = true;
+                }
+                scratch_arena_release(scratch_mark);
+                goto LABLE_MULTIPLY_FINISH;
+            }
+            scratch_arena_release(scratch_mark);    // arena full, schoolbook needs nothing
+        }
         
-        for(size_t index = parm2_lowest_bit_index; index <= parm2_highest_bit_index; index++)
-            if(extended_integer_inline_get_bit(parm2, length, index)) {
-                extended_integer_inline_bit_offset(parm1, offseted_parm1, length,(int)index);
-                extended_integer_copy(result, pre_saved_result, length);
-                extended_integer_add(offseted_parm1, pre_saved_result, result, length, is_overflow ? NULL : &is_overflow);
+        // schoolbook, each row accumulates parm1 x parm2[row] into result from element row
+        for(size_t row = 0; row < parm2_used_length; row++) {
+            EXT_DOUBLE_TYPE multiplier = parm2[row];
+            if(multiplier == 0) continue;
+            EXT_DOUBLE_TYPE carry = 0;
+            size_t index;
+            for(index = 0; index < parm1_used_length && row + index < length; index++) {
+                EXT_DOUBLE_TYPE product = parm1[index] * multiplier + result[row + index] + carry;
+                result[row + index] = (EXT_TYPE)product;
+                carry = product >> EXT_BIT;
             }
-        LABLE_QUICK_FINISH:
+            // highest element of parm1 is non-zero, any truncated product overflows
+            if(index < parm1_used_length) is_overflow = true;
+            else if(row + index < length) result[row + index] = (EXT_TYPE)carry;
+            else if(carry != 0) is_overflow = true;
+        }
+        
+        LABLE_MULTIPLY_FINISH:
         if(overflow != NULL) overflow[0] = is_overflow;
         
     } DEBUG_ELSE
@@ -257,58 +302,129 @@ void extended_integer_divide(EXT_ARRAY _Nonnull parm1,
                              EXT_ARRAY _Nonnull restrict result,
                              size_t length,
                              bool * _Nullable error_flag) {
-    if(parm1 != NULL && parm2 != NULL && result != NULL && length > 0) {
+    extended_integer_divide_modulo(parm1, parm2, result, NULL, length, error_flag);
+}
+
+void extended_integer_divide_modulo(EXT_ARRAY _Nonnull parm1,
+                                    EXT_ARRAY _Nonnull parm2,
+                                    EXT_ARRAY _Nullable quotient,
+                                    EXT_ARRAY _Nullable remainder,
+                                    size_t length,
+                                    bool * _Nullable error_flag) {
+    if(parm1 != NULL && parm2 != NULL && length > 0) {
         bool is_error = false;
         
-        extended_integer_inline_all_zero(result, length);
+        // [Documentation] Knuth, TAOCP Vol.2 4.3.1 Algorithm D
+        // worked in copies, quotient and remainder are stored at last so either may be parm1
+        size_t scratch_mark = scratch_arena_mark();
+        EXT_ARRAY quotient_store = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
+        EXT_ARRAY remainder_store = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
+        if(quotient_store == NULL || remainder_store == NULL) {
+            scratch_arena_release(scratch_mark);
+            if(error_flag != NULL) error_flag[0] = true;
+            return;
+        }
+        extended_integer_inline_all_zero(quotient_store, length);
+        extended_integer_inline_all_zero(remainder_store, length);
         
-        bool parm2_all_zero; size_t parm2_highest_bit_index;
-        extended_integer_query_info(parm2, length, &parm2_all_zero, &parm2_highest_bit_index, NULL);
-        if(parm2_all_zero) {
+        size_t divisor_length = extended_integer_inline_used_length(parm2, length);
+        size_t dividend_length = extended_integer_inline_used_length(parm1, length);
+        
+        if(divisor_length == 0) {
             is_error = true;
             goto LABLE_QUICK_FINISH;
         }
         
-        bool parm1_all_zero; size_t parm1_highest_bit_index;
-        extended_integer_query_info(parm1, length, &parm1_all_zero, &parm1_highest_bit_index, NULL);
-        if(parm1_all_zero) goto LABLE_QUICK_FINISH;
-        
-        if(parm2_highest_bit_index > parm1_highest_bit_index) goto LABLE_QUICK_FINISH;
+        if(dividend_length < divisor_length) {
+            extended_integer_copy(parm1, remainder_store, length);
+            goto LABLE_QUICK_FINISH;
+        }
         
-        size_t offset = parm1_highest_bit_index - parm2_highest_bit_index;
+        if(divisor_length == 1) {
+            // short division
+            EXT_DOUBLE_TYPE divisor = parm2[0];
+            EXT_DOUBLE_TYPE rest = 0;
+            for(size_t index = dividend_length; index > 0; index--) {
+                EXT_DOUBLE_TYPE current = (rest << EXT_BIT) | parm1[index - 1];
+                quotient_store[index - 1] = (EXT_TYPE)(current / divisor);
+                rest = current % divisor;
+            }
+            remainder_store[0] = (EXT_TYPE)rest;
+            goto LABLE_QUICK_FINISH;
+        }
         
-        EXT_ARRAY parm1_taken = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
-        EXT_ARRAY parm2_offset = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
-        EXT_ARRAY temp = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
+        size_t n = divisor_length;
+        size_t m = dividend_length - divisor_length;
         
-        extended_integer_copy(parm1, parm1_taken, length);
+        // [D1] normalize, highest bit of divisor set
+        unsigned int shift = extended_integer_inline_leading_zero(parm2[n - 1]);
+        EXT_ARRAY divisor = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * n);
+        EXT_ARRAY dividend = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * (m + n + 1));
+        if(divisor == NULL || dividend == NULL) {
+            is_error = true;
+            goto LABLE_QUICK_FINISH;
+        }
+        for(size_t index = n - 1; index > 0; index--)
+            divisor[index] = (parm2[index] << shift) | (shift ? parm2[index - 1] >> (EXT_BIT - shift) : 0);
+        divisor[0] = parm2[0] << shift;
+        dividend[m + n] = shift ? parm1[m + n - 1] >> (EXT_BIT - shift) : 0;
+        for(size_t index = m + n - 1; index > 0; index--)
+            dividend[index] = (parm1[index] << shift) | (shift ? parm1[index - 1] >> (EXT_BIT - shift) : 0);
+        dividend[0] = parm1[0] << shift;
         
-        bool downflow;
+        EXT_DOUBLE_TYPE divisor_high = divisor[n - 1];
+        EXT_DOUBLE_TYPE divisor_next = divisor[n - 2];
         
-        LOOP {
-            extended_integer_inline_bit_offset(parm2, parm2_offset, length, (int)offset);
-            
-            int compare_result = extended_integer_compare(parm1_taken, parm2_offset, length);
-            
-            if(compare_result > 0) {
-                extended_integer_sbtract(parm1_taken, parm2_offset, temp, length, &downflow); DEBUG_ASSERT(!downflow);
-                extended_integer_copy(temp, parm1_taken, length);
-                extended_integer_inline_set_bit(result, length, offset, true);
+        for(size_t j = m + 1; j-- > 0;) {
+            // [D3] estimate from top two elements, at most two too large after the fix
+            EXT_DOUBLE_TYPE numerator = ((EXT_DOUBLE_TYPE)dividend[j + n] << EXT_BIT) | dividend[j + n - 1];
+            EXT_DOUBLE_TYPE estimate = numerator / divisor_high;
+            EXT_DOUBLE_TYPE rest = numerator % divisor_high;
+            while(estimate > EXT_MAX || estimate * divisor_next > ((rest << EXT_BIT) | dividend[j + n - 2])) {
+                estimate--;
+                rest += divisor_high;
+                if(rest > EXT_MAX) break;
             }
-            else if(compare_result == 0) {
-                extended_integer_inline_set_bit(result, length, offset, true);
-                break;
+            
+            // [D4] multiply and subtract
+            EXT_DOUBLE_TYPE carry = 0;
+            EXT_TYPE borrow = 0;
+            for(size_t index = 0; index < n; index++) {
+                EXT_DOUBLE_TYPE product = estimate * divisor[index] + carry;
+                carry = product >> EXT_BIT;
+                EXT_TYPE before = dividend[index + j];
+                EXT_TYPE low = (EXT_TYPE)product;
+                dividend[index + j] = before - low - borrow;
+                borrow = (before < low) || (EXT_TYPE)(before - low) < borrow;
             }
+            EXT_TYPE before = dividend[j + n];
+            dividend[j + n] = before - (EXT_TYPE)carry - borrow;
+            borrow = (before < (EXT_TYPE)carry) || (EXT_TYPE)(before - (EXT_TYPE)carry) < borrow;
             
-            if(offset == 0) break;
-            else offset = offset - 1;
+            // [D6] add back, rare
+            if(borrow) {
+                estimate--;
+                EXT_DOUBLE_TYPE sum_carry = 0;
+                for(size_t index = 0; index < n; index++) {
+                    EXT_DOUBLE_TYPE sum = (EXT_DOUBLE_TYPE)dividend[index + j] + divisor[index] + sum_carry;
+                    dividend[index + j] = (EXT_TYPE)sum;
+                    sum_carry = sum >> EXT_BIT;
+                }
+                dividend[j + n] += (EXT_TYPE)sum_carry;
+            }
+            quotient_store[j] = (EXT_TYPE)estimate;
         }
         
-        // break exit
+        // [D8] unnormalize
+        for(size_t index = 0; index < n; index++)
+            remainder_store[index] = (dividend[index] >> shift) | (shift ? dividend[index + 1] << (EXT_BIT - shift) : 0);
         
         LABLE_QUICK_FINISH:
         DEBUG_ASSERT(!is_error);    // divide zero breakpoint
+        if(quotient != NULL) extended_integer_copy(quotient_store, quotient, length);
+        if(remainder != NULL) extended_integer_copy(remainder_store, remainder, length);
         if(error_flag != NULL) error_flag[0] = is_error;
+        scratch_arena_release(scratch_mark);
         
     } DEBUG_ELSE
 }
@@ -328,6 +444,28 @@ void extended_integer_set_bit(EXT_ARRAY _Nonnull array,
     extended_integer_inline_set_bit(array, length, bit_index, value);
 }
 
+void extended_integer_set_uint64(EXT_ARRAY _Nonnull array,
+                                 size_t length,
+                                 size_t bit_index,
+                                 uint64_t value) {
+    if(array != NULL && length > 0 && bit_index < length * EXT_BIT) {
+        size_t index = bit_index / EXT_BIT;
+        // bit zero of array[index] lands at position of value
+        for(int position = - (int)(bit_index % EXT_BIT); position < 64 && index < length; position += EXT_BIT, index++) {
+            EXT_TYPE mask, part;
+            if(position < 0) {
+                mask = EXT_MAX << (- position);
+                part = (EXT_TYPE)(value << (- position));
+            }
+            else {
+                mask = (EXT_TYPE)(UINT64_MAX >> position);
+                part = (EXT_TYPE)(value >> position);
+            }
+            array[index] = (array[index] & ~ mask) | (part & mask);
+        }
+    } DEBUG_ELSE
+}
+
 void extended_integer_bit_offset(EXT_ARRAY _Nonnull restrict array,
                                  EXT_ARRAY _Nonnull restrict result,
                                  size_t length,
@@ -472,106 +610,113 @@ static inline void extended_integer_inline_bit_offset(EXT_ARRAY _Nonnull restric
 #pragma mark - Quick Function
 
 void extended_integer_quick_multiply(EXT_ARRAY _Nonnull array,
-                                     uint32_t value,
+                                     EXT_TYPE value,
                                      size_t length,
                                      bool * _Nullable overflow) {
     if(array != NULL && length > 0) {
-        
-        bool is_overflow = false;
-        
-        EXT_ARRAY result = EXTENDED_INTEGER_TEMP_ALLOC(length * sizeof(EXT_TYPE));
-        
-        // anyway to all zero result
-        extended_integer_inline_all_zero(result, length);
-        
-        bool array_all_zero;
-        size_t array_highest_bit_index;
-        extended_integer_query_info(array, length, &array_all_zero, &array_highest_bit_index, NULL);
-        if(array_all_zero) goto LABLE_QUICK_FINISH;
-        
-        EXT_ARRAY temp1 = EXTENDED_INTEGER_TEMP_ALLOC(length * sizeof(EXT_TYPE));
-        EXT_ARRAY temp2 = EXTENDED_INTEGER_TEMP_ALLOC(length * sizeof(EXT_TYPE));
-        
-        DEBUG_ASSERT(sizeof(uint32_t) * CHAR_BIT == 32);
-        for(size_t index = 0; index < sizeof(uint32_t) * CHAR_BIT; index++) {
-            uint32_t query = UINT32_C(1) << index;
-            if(query & value) {
-                if(!is_overflow) {
-                    size_t highest_bit_index_after_offset = array_highest_bit_index + index;
-                    size_t highest_bit_count_possible = EXT_BIT * length;
-                    if(highest_bit_index_after_offset >= highest_bit_count_possible)
-                        is_overflow = true;
-                }
-                extended_integer_inline_bit_offset(array, temp1, length, (int)index);
-                bool this_time_overflow;
-                extended_integer_add(temp1, result, temp2, length, &this_time_overflow);
-                DEVELOP_ASSERT(!this_time_overflow);
-                if(!is_overflow && this_time_overflow) is_overflow = true;
-                extended_integer_copy(temp2, result, length);
-            }
+        EXT_DOUBLE_TYPE carry = 0;
+        for(size_t index = 0; index < length; index++) {
+            EXT_DOUBLE_TYPE product = (EXT_DOUBLE_TYPE)array[index] * value + carry;
+            array[index] = (EXT_TYPE)product;
+            carry = product >> EXT_BIT;
         }
-        
-        LABLE_QUICK_FINISH:
-        if(overflow != NULL) overflow[0] = is_overflow;
-        extended_integer_copy(result, array, length);
-        
+        if(overflow != NULL) overflow[0] = carry != 0;
+    } DEBUG_ELSE
+}
+
+void extended_integer_quick_multiply_add(EXT_ARRAY _Nonnull array,
+                                         EXT_TYPE value,
+                                         EXT_ARRAY _Nonnull addend,
+                                         EXT_ARRAY _Nonnull restrict result,
+                                         size_t length,
+                                         bool * _Nullable overflow) {
+    if(array != NULL && addend != NULL && result != NULL && length > 0) {
+        EXT_DOUBLE_TYPE carry = 0;
+        for(size_t index = 0; index < length; index++) {
+            // limb x value + limb + carry fits EXT_DOUBLE_TYPE
+            EXT_DOUBLE_TYPE product = (EXT_DOUBLE_TYPE)array[index] * value + addend[index] + carry;
+            result[index] = (EXT_TYPE)product;
+            carry = product >> EXT_BIT;
+        }
+        if(overflow != NULL) overflow[0] = carry != 0;
     } DEBUG_ELSE
 }
 
-uint32_t extended_integer_quick_divide_modulo(EXT_ARRAY _Nonnull restrict dividend,
+EXT_TYPE extended_integer_quick_divide_modulo(EXT_ARRAY _Nonnull restrict dividend,
                                               EXT_ARRAY _Nonnull restrict divisor,
                                               size_t length,
                                               bool * _Nullable error_flag) {
     if(dividend != NULL && divisor != NULL && length != 0) {
-        bool error = false; uint32_t result = 0;
+        bool error = false; EXT_TYPE result = 0;
         
-        bool divisor_all_zero; size_t divisor_highest_bit_index;
-        extended_integer_query_info(divisor, length, &divisor_all_zero, &divisor_highest_bit_index, NULL);
-        if(divisor_all_zero) { error = true; goto LABLE_QUICK_FINISH; }
+        // each scanned once, elements above the longer one are zero
+        size_t divisor_bit = extended_integer_inline_bit_length(divisor, length);
+        if(divisor_bit == 0) { error = true; goto LABLE_QUICK_FINISH; }
+        size_t dividend_bit = extended_integer_inline_bit_length(dividend, length);
         
         // quick finish flag
-        if(extended_integer_compare(dividend, divisor, length) < 0)
+        if(dividend_bit < divisor_bit) goto LABLE_QUICK_FINISH;
+        length = EXT_ARRAY_SIZE_FOR_BIT(dividend_bit);
+        if(dividend_bit == divisor_bit && extended_integer_compare(dividend, divisor, length) < 0)
             goto LABLE_QUICK_FINISH;
         
-        // divide
+        if(dividend_bit <= divisor_bit + 31) {
+            // quotient less than 2^32, estimated from top 32 bit of divisor
+            // and the dividend bits above the same position, never larger than quotient
+            size_t shift = divisor_bit > 32 ? divisor_bit - 32 : 0;
+            uint64_t divisor_top = extended_integer_inline_window(divisor, length, shift);
+            uint64_t dividend_top = extended_integer_inline_window(dividend, length, shift);
+            uint64_t estimate = dividend_top / (shift > 0 ? divisor_top + 1 : divisor_top);
+            
+            // dividend -= estimate x divisor
+            EXT_DOUBLE_TYPE carry = 0;
+            EXT_TYPE borrow = 0;
+            for(size_t index = 0; index < length; index++) {
+                EXT_DOUBLE_TYPE product = (EXT_DOUBLE_TYPE)divisor[index] * estimate + carry;
+                carry = product >> EXT_BIT;
+                EXT_TYPE before = dividend[index];
+                EXT_TYPE low = (EXT_TYPE)product;
+                dividend[index] = before - low - borrow;
+                borrow = (before < low) || (EXT_TYPE)(before - low) < borrow;
+            }
+            DEBUG_ASSERT(carry == 0 && borrow == 0);
+            
+            // at most two for single digit quotient
+            while(extended_integer_compare(dividend, divisor, length) >= 0) {
+                borrow = 0;
+                for(size_t index = 0; index < length; index++) {
+                    EXT_TYPE before = dividend[index];
+                    dividend[index] = before - divisor[index] - borrow;
+                    borrow = (before < divisor[index]) || (EXT_TYPE)(before - divisor[index]) < borrow;
+                }
+                estimate++;
+            }
+            DEBUG_ASSERT(estimate <= UINT32_MAX);
+            result = (EXT_TYPE)estimate;
+            goto LABLE_QUICK_FINISH;
+        }
+        
+        // divide, remainder stored back into dividend
         bool should_be_false;
+        size_t scratch_mark = scratch_arena_mark();
         EXT_ARRAY quotient = EXTENDED_INTEGER_TEMP_ALLOC(length * sizeof(EXT_TYPE));
-        extended_integer_divide(dividend, divisor, quotient, length, &should_be_false);
+        if(quotient == NULL) { error = true; goto LABLE_QUICK_FINISH; }
+        extended_integer_divide_modulo(dividend, divisor, quotient, dividend, length, &should_be_false);
         DEBUG_ASSERT(!should_be_false);
-        if(should_be_false) { error = true; goto LABLE_QUICK_FINISH; }
         
         // query
-        bool quotient_all_zero; size_t quotient_highest_bit_index;
-        extended_integer_query_info(quotient, length, &quotient_all_zero, &quotient_highest_bit_index, NULL);
-        DEBUG_ASSERT(!quotient_all_zero);
-        if(quotient_all_zero) { error = true; goto LABLE_QUICK_FINISH; }
+        size_t quotient_used_length = extended_integer_inline_used_length(quotient, length);
+        DEBUG_ASSERT(quotient_used_length > 0);
         
         // result intial is zero
         
-        COMILE_ASSERT(sizeof(uint32_t) * CHAR_BIT == 32);
-        if(quotient_highest_bit_index >= sizeof(uint32_t) * CHAR_BIT)
-            error = true;   // overflow uint32_t
-        
-        if (sizeof(EXT_TYPE) == sizeof(uint32_t))
-            result = quotient[0];
+        if(should_be_false || quotient_used_length == 0) error = true;
         else {
-            DEBUG_LOG("[STDC] extended_integer_quick_divide_modulo optimization code may required");
-            size_t to_index = sizeof(uint32_t) * CHAR_BIT - 1;
-            if(quotient_highest_bit_index < to_index)
-                to_index = quotient_highest_bit_index;
-            for(size_t index = 0; index <= to_index; index++)
-                if(extended_integer_inline_get_bit(quotient, length, index))
-                    result |= (UINT32_C(1) << index);
+            if(quotient_used_length > 1)
+                error = true;   // overflow EXT_TYPE
+            result = quotient[0];
         }
-        EXT_ARRAY product = EXTENDED_INTEGER_TEMP_ALLOC(length * sizeof(EXT_TYPE));
-        extended_integer_multiply(divisor, quotient, product, length, &should_be_false);
-        DEBUG_ASSERT(!should_be_false);
-        if(should_be_false) { error = true; goto LABLE_QUICK_FINISH; }
-        EXT_ARRAY difference = EXTENDED_INTEGER_TEMP_ALLOC(length * sizeof(EXT_TYPE));
-        extended_integer_sbtract(dividend, product, difference, length,  &should_be_false);
-        DEBUG_ASSERT(!should_be_false);
-        if(should_be_false) { error = true; goto LABLE_QUICK_FINISH; }
-        extended_integer_copy(difference, dividend, length);
+        scratch_arena_release(scratch_mark);
         
         LABLE_QUICK_FINISH:
         if(error_flag != NULL) error_flag[0] = error;
@@ -581,80 +726,294 @@ uint32_t extended_integer_quick_divide_modulo(EXT_ARRAY _Nonnull restrict divide
     DEBUG_RETURN(0);
 }
 
-#pragma mark - Static Definition
-
-static void extended_integer_query_info(EXT_ARRAY _Nonnull restrict array,
-                                        size_t length,
-                                        bool * _Nonnull restrict all_zero,
-                                        size_t * _Nullable restrict highest_bit_index,
-                                        size_t * _Nullable restrict lowest_bit_index) {
-    if(array != NULL && length > 0) { DEBUG_ASSERT(all_zero != NULL);
-        bool is_all_zero = true;
-        size_t high_index = 0;      // only valid if is_all_zero (false)
-        size_t low_index = 0;       // only valid if is_all_zero (false)
-        if(all_zero != NULL) {
-            size_t serach_index;
-            for(serach_index = 0; serach_index < length; serach_index++)
-                if(array[serach_index] != 0) {
-                    is_all_zero = false;
-                    low_index = serach_index;
-                    break;
-                }
-            DEBUG_ASSERT(serach_index >= length ? is_all_zero : !is_all_zero);
-            if(serach_index < length) {
-                if(serach_index + 1 == length) high_index = serach_index;
-                else {
-                    size_t reverse_search_index;
-                    for(reverse_search_index = length - 1; reverse_search_index > serach_index; reverse_search_index--)
-                        if(array[reverse_search_index] != 0)
-                            break;
-                    DEBUG_ASSERT(reverse_search_index >= serach_index);
-                    high_index = reverse_search_index;
-                }
-            }
-            all_zero[0] = is_all_zero;
-        }
-        if(highest_bit_index != NULL) {
-            if(all_zero != NULL) {
-                if(is_all_zero) highest_bit_index[0] = 0;
-                else {
-                    size_t offset;
-                    for(offset = 0; offset < EXT_BIT; offset++) {
-                        EXT_TYPE value = (EXT_TYPE_C(1) << (EXT_BIT - offset - 1));
-                        if(array[high_index] & value) {
-                            highest_bit_index[0] = (high_index * EXT_BIT + (EXT_BIT - offset - 1));
-                            break;
-                        }
-                    }
-                    if(offset >= EXT_BIT) {
-                        highest_bit_index[0] = 0;
-                        DEBUG_POINT;    // should not be reached
-                    }
-                }
-            } else { highest_bit_index[0] = 0; DEBUG_POINT; }
-        }
-        if(lowest_bit_index != NULL) {
-            if(all_zero != NULL) {
-                if(is_all_zero) lowest_bit_index[0] = 0;
-                else {
-                    size_t offset;
-                    for(offset = 0; offset < EXT_BIT; offset++) {
-                        EXT_TYPE value = (EXT_TYPE_C(1) << offset);
-                        if(array[low_index] & value) {
-                            lowest_bit_index[0] = (low_index * EXT_BIT + offset);
-                            break;
-                        }
-                    }
-                    if(offset >= EXT_BIT) {
-                        lowest_bit_index[0] = 0;
-                        DEBUG_POINT;    // should not be reached
+void extended_integer_pow_uint32(uint32_t base,
+                                 uint32_t exponent,
+                                 EXT_ARRAY _Nonnull result,
+                                 size_t length,
+                                 bool * _Nullable overflow) {
+    if(result != NULL && length > 0) {
+        bool is_overflow = false;
+        extended_integer_inline_all_zero(result, length);
+        result[0] = 1;
+        if(exponent > 0) {
+            size_t scratch_mark = scratch_arena_mark();
+            EXT_ARRAY square = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * length);
+            if(square != NULL) {
+                // left to right, highest bit starts result at base
+                result[0] = base;
+                bool temp_overflow;
+                for(int bit = 30 - __builtin_clz(exponent); bit >= 0; bit--) {
+                    extended_integer_multiply(result, result, square, length, &temp_overflow);
+                    extended_integer_copy(square, result, length);
+                    is_overflow |= temp_overflow;
+                    if(exponent & (UINT32_C(1) << bit)) {
+                        extended_integer_quick_multiply(result, base, length, &temp_overflow);
+                        is_overflow |= temp_overflow;
                     }
                 }
-            } else { lowest_bit_index[0] = 0; DEBUG_POINT; }
+            } else {
+                DEBUG_POINT;
+                is_overflow = true;     // scratch arena full
+            }
+            scratch_arena_release(scratch_mark);
         }
+        if(overflow != NULL) overflow[0] = is_overflow;
     } DEBUG_ELSE
 }
 
+#pragma mark - Multiply Static Definition
+
+/*!
+    @function extended_integer_inline_span_add
+    @abstract destination += source, source_length not more than destination_length
+    @return carry out of destination
+ */
+static inline EXT_TYPE extended_integer_inline_span_add(EXT_ARRAY _Nonnull restrict destination,
+                                                        size_t destination_length,
+                                                        EXT_ARRAY _Nonnull restrict source,
+                                                        size_t source_length) {
+    EXT_DOUBLE_TYPE carry = 0;
+    size_t index;
+    for(index = 0; index < source_length; index++) {
+        EXT_DOUBLE_TYPE sum = (EXT_DOUBLE_TYPE)destination[index] + source[index] + carry;
+        destination[index] = (EXT_TYPE)sum;
+        carry = sum >> EXT_BIT;
+    }
+    for(; carry != 0 && index < destination_length; index++)
+        carry = ++destination[index] == 0;
+    return (EXT_TYPE)carry;
+}
+
+/*!
+    @function extended_integer_inline_span_subtract
+    @abstract destination -= source, source_length not more than destination_length
+    @return borrow out of destination
+ */
+static inline EXT_TYPE extended_integer_inline_span_subtract(EXT_ARRAY _Nonnull restrict destination,
+                                                             size_t destination_length,
+                                                             EXT_ARRAY _Nonnull restrict source,
+                                                             size_t source_length) {
+    EXT_TYPE borrow = 0;
+    size_t index;
+    for(index = 0; index < source_length; index++) {
+        EXT_TYPE before = destination[index];
+        destination[index] = before - source[index] - borrow;
+        borrow = (before < source[index]) || (EXT_TYPE)(before - source[index]) < borrow;
+    }
+    for(; borrow != 0 && index < destination_length; index++)
+        borrow = destination[index]-- == 0;
+    return borrow;
+}
+
+static void extended_integer_schoolbook_product(EXT_ARRAY _Nonnull parm1,
+                                                size_t parm1_length,
+                                                EXT_ARRAY _Nonnull parm2,
+                                                size_t parm2_length,
+                                                EXT_ARRAY _Nonnull restrict product) {
+    extended_integer_inline_all_zero(product, parm1_length + parm2_length);
+    for(size_t row = 0; row < parm2_length; row++) {
+        EXT_DOUBLE_TYPE multiplier = parm2[row];
+        if(multiplier == 0) continue;
+        EXT_DOUBLE_TYPE carry = 0;
+        for(size_t index = 0; index < parm1_length; index++) {
+            EXT_DOUBLE_TYPE sum = parm1[index] * multiplier + product[row + index] + carry;
+            product[row + index] = (EXT_TYPE)sum;
+            carry = sum >> EXT_BIT;
+        }
+        product[row + parm1_length] = (EXT_TYPE)carry;
+    }
+}
+
+static bool extended_integer_karatsuba_product(EXT_ARRAY _Nonnull parm1,
+                                               size_t parm1_length,
+                                               EXT_ARRAY _Nonnull parm2,
+                                               size_t parm2_length,
+                                               EXT_ARRAY _Nonnull restrict product,
+                                               size_t threshold) {
+    // [Documentation] Knuth, TAOCP Vol.2 4.3.3 A
+    if(parm1_length < parm2_length) {
+        EXT_ARRAY temp = parm1; parm1 = parm2; parm2 = temp;
+        size_t temp_length = parm1_length; parm1_length = parm2_length; parm2_length = temp_length;
+    }
+    // sums of halves take one more element, below four they never get shorter
+    if(parm2_length < threshold || parm2_length < 4) {
+        extended_integer_schoolbook_product(parm1, parm1_length, parm2, parm2_length, product);
+        return true;
+    }
+    
+    bool success = false;
+    size_t product_length = parm1_length + parm2_length;
+    size_t half = (parm1_length + 1) / 2;
+    size_t high1_length = parm1_length - half;
+    size_t scratch_mark = scratch_arena_mark();
+    
+    if(parm2_length <= half) {
+        // unbalanced, product = low1 x parm2 + (high1 x parm2) << half
+        EXT_ARRAY high_product = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * (high1_length + parm2_length));
+        if(high_product == NULL) goto LABLE_KARATSUBA_FINISH;
+        if(!extended_integer_karatsuba_product(parm1, half, parm2, parm2_length, product, threshold))
+            goto LABLE_KARATSUBA_FINISH;
+        extended_integer_inline_all_zero(product + half + parm2_length, product_length - half - parm2_length);
+        if(!extended_integer_karatsuba_product(parm1 + half, high1_length, parm2, parm2_length, high_product, threshold))
+            goto LABLE_KARATSUBA_FINISH;
+        EXT_TYPE carry = extended_integer_inline_span_add(product + half, product_length - half,
+                                                          high_product, high1_length + parm2_length);
+        DEBUG_ASSERT(carry == 0); (void)carry;
+        success = true;
+        goto LABLE_KARATSUBA_FINISH;
+    }
+    
+    // low x low at bottom and high x high at top of product, both [half] split
+    size_t high2_length = parm2_length - half;
+    if(!extended_integer_karatsuba_product(parm1, half, parm2, half, product, threshold))
+        goto LABLE_KARATSUBA_FINISH;
+    if(!extended_integer_karatsuba_product(parm1 + half, high1_length, parm2 + half, high2_length,
+                                           product + half * 2, threshold))
+        goto LABLE_KARATSUBA_FINISH;
+    
+    // middle = (low1 + high1) x (low2 + high2) - low x low - high x high
+    EXT_ARRAY sum1 = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * (half + 1));
+    EXT_ARRAY sum2 = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * (half + 1));
+    EXT_ARRAY middle = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * (half + 1) * 2);
+    if(sum1 == NULL || sum2 == NULL || middle == NULL) goto LABLE_KARATSUBA_FINISH;
+    extended_integer_copy(parm1, sum1, half);
+    sum1[half] = extended_integer_inline_span_add(sum1, half, parm1 + half, high1_length);
+    extended_integer_copy(parm2, sum2, half);
+    sum2[half] = extended_integer_inline_span_add(sum2, half, parm2 + half, high2_length);
+    if(!extended_integer_karatsuba_product(sum1, half + 1, sum2, half + 1, middle, threshold))
+        goto LABLE_KARATSUBA_FINISH;
+    EXT_TYPE borrow = extended_integer_inline_span_subtract(middle, (half + 1) * 2, product, half * 2);
+    borrow |= extended_integer_inline_span_subtract(middle, (half + 1) * 2, product + half * 2, high1_length + high2_length);
+    DEBUG_ASSERT(borrow == 0);
+    
+    // low1 x high2 + high1 x low2 is less than product >> half
+    size_t middle_length = extended_integer_inline_used_length(middle, (half + 1) * 2);
+    DEBUG_ASSERT(middle_length <= product_length - half);
+    if(middle_length > product_length - half) goto LABLE_KARATSUBA_FINISH;
+    EXT_TYPE carry = extended_integer_inline_span_add(product + half, product_length - half, middle, middle_length);
+    DEBUG_ASSERT(carry == 0); (void)carry;
+    success = true;
+    
+    LABLE_KARATSUBA_FINISH:
+    scratch_arena_release(scratch_mark);
+    return success;
+}
+
+#pragma mark - Carry Chain Static Definition
+
+static bool extended_integer_carry_add_portable(EXT_ARRAY _Nonnull parm1,
+                                                EXT_ARRAY _Nonnull parm2,
+                                                EXT_ARRAY _Nonnull restrict result,
+                                                size_t length) {
+    // carry in first, at most one of the two overflows happens so the flags add up to zero or one
+    EXT_TYPE carry = 0;
+    for(size_t index = 0; index < length; index++) {
+        EXT_TYPE sum;
+        EXT_TYPE carry_first = __builtin_add_overflow(parm1[index], carry, &sum);
+        EXT_TYPE carry_second = __builtin_add_overflow(sum, parm2[index], &sum);
+        result[index] = sum;
+        carry = carry_first + carry_second;
+    }
+    return carry != 0;
+}
+
+static bool extended_integer_carry_sbtract_portable(EXT_ARRAY _Nonnull parm1,
+                                                    EXT_ARRAY _Nonnull parm2,
+                                                    EXT_ARRAY _Nonnull restrict result,
+                                                    size_t length) {
+    EXT_TYPE borrow = 0;
+    for(size_t index = 0; index < length; index++) {
+        EXT_TYPE difference;
+        EXT_TYPE borrow_first = __builtin_sub_overflow(parm1[index], borrow, &difference);
+        EXT_TYPE borrow_second = __builtin_sub_overflow(difference, parm2[index], &difference);
+        result[index] = difference;
+        borrow = borrow_first + borrow_second;
+    }
+    return borrow != 0;
+}
+
+#ifdef EXTENDED_INTEGER_CARRY_CHAIN_ADX
+
+/*!
+    @function extended_integer_carry_add_adx
+    @abstract single ADCX chain unrolled by four, the flag only leaves CF between groups
+ */
+__attribute__((target("adx")))
+static bool extended_integer_carry_add_adx(EXT_ARRAY _Nonnull parm1,
+                                           EXT_ARRAY _Nonnull parm2,
+                                           EXT_ARRAY _Nonnull restrict result,
+                                           size_t length) {
+    unsigned long long *sum = (unsigned long long *)result;
+    unsigned char carry = 0;
+    size_t index = 0;
+    for(; index + 4 <= length; index += 4) {
+        carry = _addcarryx_u64(carry, parm1[index], parm2[index], sum + index);
+        carry = _addcarryx_u64(carry, parm1[index + 1], parm2[index + 1], sum + index + 1);
+        carry = _addcarryx_u64(carry, parm1[index + 2], parm2[index + 2], sum + index + 2);
+        carry = _addcarryx_u64(carry, parm1[index + 3], parm2[index + 3], sum + index + 3);
+    }
+    for(; index < length; index++)
+        carry = _addcarryx_u64(carry, parm1[index], parm2[index], sum + index);
+    return carry;
+}
+
+/*!
+    @function extended_integer_carry_sbtract_adx
+    @abstract SBB chain unrolled by four, no borrow form of ADCX exists
+ */
+__attribute__((target("adx")))
+static bool extended_integer_carry_sbtract_adx(EXT_ARRAY _Nonnull parm1,
+                                               EXT_ARRAY _Nonnull parm2,
+                                               EXT_ARRAY _Nonnull restrict result,
+                                               size_t length) {
+    unsigned long long *difference = (unsigned long long *)result;
+    unsigned char borrow = 0;
+    size_t index = 0;
+    for(; index + 4 <= length; index += 4) {
+        borrow = _subborrow_u64(borrow, parm1[index], parm2[index], difference + index);
+        borrow = _subborrow_u64(borrow, parm1[index + 1], parm2[index + 1], difference + index + 1);
+        borrow = _subborrow_u64(borrow, parm1[index + 2], parm2[index + 2], difference + index + 2);
+        borrow = _subborrow_u64(borrow, parm1[index + 3], parm2[index + 3], difference + index + 3);
+    }
+    for(; index < length; index++)
+        borrow = _subborrow_u64(borrow, parm1[index], parm2[index], difference + index);
+    return borrow;
+}
+
+#endif
+
+static void extended_integer_carry_chain_select(void) {
+    extended_integer_carry_chain_func_t add_kernel = extended_integer_carry_add_portable;
+    extended_integer_carry_chain_func_t sbtract_kernel = extended_integer_carry_sbtract_portable;
+#ifdef EXTENDED_INTEGER_CARRY_CHAIN_ADX
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("adx")) {
+        add_kernel = extended_integer_carry_add_adx;
+        sbtract_kernel = extended_integer_carry_sbtract_adx;
+    }
+#endif
+    __atomic_store_n(&extended_integer_carry_add, add_kernel, __ATOMIC_RELAXED);
+    __atomic_store_n(&extended_integer_carry_sbtract, sbtract_kernel, __ATOMIC_RELAXED);
+}
+
+static bool extended_integer_carry_add_dispatch(EXT_ARRAY _Nonnull parm1,
+                                                EXT_ARRAY _Nonnull parm2,
+                                                EXT_ARRAY _Nonnull restrict result,
+                                                size_t length) {
+    extended_integer_carry_chain_select();
+    return __atomic_load_n(&extended_integer_carry_add, __ATOMIC_RELAXED)(parm1, parm2, result, length);
+}
+
+static bool extended_integer_carry_sbtract_dispatch(EXT_ARRAY _Nonnull parm1,
+                                                    EXT_ARRAY _Nonnull parm2,
+                                                    EXT_ARRAY _Nonnull restrict result,
+                                                    size_t length) {
+    extended_integer_carry_chain_select();
+    return __atomic_load_n(&extended_integer_carry_sbtract, __ATOMIC_RELAXED)(parm1, parm2, result, length);
+}
+
+#pragma mark - Static Definition
+
 // compiler comm optimization for __platfrom_bzero code
 static inline void extended_integer_inline_all_zero(EXT_ARRAY _Nonnull array, size_t length) {
     if(array != NULL && length > 0) {
@@ -663,6 +1022,37 @@ static inline void extended_integer_inline_all_zero(EXT_ARRAY _Nonnull array, si
     } DEBUG_ELSE
 }
 
+static inline size_t extended_integer_inline_used_length(EXT_ARRAY _Nonnull array, size_t length) {
+    if(array != NULL) {
+        while(length > 0 && array[length - 1] == 0) length--;
+        return length;
+    } DEBUG_ELSE
+    return 0;
+}
+
+static inline unsigned int extended_integer_inline_leading_zero(EXT_TYPE value) {
+    DEBUG_ASSERT(value != 0);
+    return (unsigned int)__builtin_clzll(value) - (sizeof(unsigned long long) * CHAR_BIT - EXT_BIT);
+}
+
+static inline size_t extended_integer_inline_bit_length(EXT_ARRAY _Nonnull array, size_t length) {
+    size_t used_length = extended_integer_inline_used_length(array, length);
+    if(used_length == 0) return 0;
+    return used_length * EXT_BIT - extended_integer_inline_leading_zero(array[used_length - 1]);
+}
+
+static inline uint64_t extended_integer_inline_window(EXT_ARRAY _Nonnull array, size_t length, size_t bit_index) {
+    uint64_t window = 0;
+    size_t index = bit_index / EXT_BIT;
+    // bit zero of array[index] lands at position of window
+    for(int position = - (int)(bit_index % EXT_BIT); position < 64 && index < length; position += EXT_BIT, index++) {
+        uint64_t value = array[index];
+        if(position < 0) window |= value >> (- position);
+        else window |= value << position;
+    }
+    return window;
+}
+
 #pragma mark - DEBUG
 
 #ifdef DEBUG
@@ -681,6 +1071,59 @@ void extended_integer_debug(EXT_ARRAY _Nullable array, size_t length) {
         fprintf(stdout, "[%2zu] %0*" EXT_PRIx "\n", index, (EXT_BIT / CHAR_BIT) * 2, array[index]);
 }
 
+void extended_integer_multiply_benchmark(void) {
+    const size_t max_length = 512;
+    size_t scratch_mark = scratch_arena_mark();
+    EXT_ARRAY parm1 = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * max_length);
+    EXT_ARRAY parm2 = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * max_length);
+    EXT_ARRAY product = EXTENDED_INTEGER_TEMP_ALLOC(sizeof(EXT_TYPE) * max_length * 2);
+    if(parm1 == NULL || parm2 == NULL || product == NULL) {
+        fprintf(stdout, "[INFO] scratch arena full\n");
+        scratch_arena_release(scratch_mark);
+        return;
+    }
+    uint64_t seed = UINT64_C(0x9E3779B97F4A7C15);
+    for(size_t index = 0; index < max_length; index++) {
+        seed = seed * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+        parm1[index] = (EXT_TYPE)(seed >> 11);
+        seed = seed * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+        parm2[index] = (EXT_TYPE)(seed >> 11);
+    }
+    
+    fprintf(stdout, "[BENCHMARK] extended_integer multiply [%d bit element] nanosecond per product\n", EXT_BIT);
+    fprintf(stdout, "%10s %12s %12s\n", "elements", "schoolbook", "karatsuba");
+    size_t crossover = 0;
+    for(size_t length = 8; length <= max_length; length += length / 4) {
+        size_t rounds = 4000000 / (length * length) + 1;
+        volatile EXT_TYPE sink = 0;
+        
+        clock_t begin = clock();
+        for(size_t round = 0; round < rounds; round++) {
+            extended_integer_schoolbook_product(parm1, length, parm2, length, product);
+            sink ^= product[length];
+        }
+        double schoolbook = (double)(clock() - begin) / CLOCKS_PER_SEC * 1e9 / rounds;
+        
+        // threshold of length, one split with schoolbook halves
+        begin = clock();
+        for(size_t round = 0; round < rounds; round++) {
+            if(!extended_integer_karatsuba_product(parm1, length, parm2, length, product, length)) break;
+            sink ^= product[length];
+        }
+        double karatsuba = (double)(clock() - begin) / CLOCKS_PER_SEC * 1e9 / rounds;
+        
+        fprintf(stdout, "%10zu %12.0f %12.0f\n", length, schoolbook, karatsuba);
+        if(karatsuba < schoolbook) {
+            if(crossover == 0) crossover = length;
+        } else crossover = 0;
+    }
+    if(crossover != 0)
+        fprintf(stdout, "[INFO] suggested EXTENDED_INTEGER_KARATSUBA_THRESHOLD %zu [current %d]\n",
+                crossover, EXTENDED_INTEGER_KARATSUBA_THRESHOLD);
+    else fprintf(stdout, "[INFO] no crossover up to %zu elements\n", max_length);
+    scratch_arena_release(scratch_mark);
+}
+
 #endif
 
 #pragma mark - Auto Test
@@ -48,13 +48,51 @@
 
 #pragma mark - Basic Info
 
+#pragma mark Behaviour Control
+
+/*!
+    @name EXTENDED_INTEGER_LIMB_64_ENABLE
+    @discussion use uint64_t as basic type with unsigned __int128 intermediate if the compiler has it,
+                halves the element amount of every array, uint32_t is used otherwise
+    @author you may choose to #define or #undef it
+ */
+#define EXTENDED_INTEGER_LIMB_64_ENABLE
+
+#if defined EXTENDED_INTEGER_LIMB_64_ENABLE && defined __SIZEOF_INT128__
+  #define EXTENDED_INTEGER_LIMB_64
+#endif
+
+/*!
+    @name EXTENDED_INTEGER_KARATSUBA_THRESHOLD
+    @discussion extended_integer_multiply uses Karatsuba when both operands have at least this many
+                non-zero leading elements, schoolbook otherwise, extended_integer_multiply_benchmark
+                reports the crossover of the build machine
+    @author you may choose to change it
+ */
+#ifdef EXTENDED_INTEGER_LIMB_64
+#define EXTENDED_INTEGER_KARATSUBA_THRESHOLD    32
+#else
+#define EXTENDED_INTEGER_KARATSUBA_THRESHOLD    48
+#endif
+
 #pragma mark DO NOT CHANGE
 
 /*!
     @typedef extended_integer_basic_type
     @abstract basic unsigned integer type used in extended integer calculation, this should be unsigned type
  */
-typedef uint32_t    extended_integer_basic_type;
+/*!
+    @typedef extended_integer_double_type
+    @abstract unsigned integer type twice the width of extended_integer_basic_type,
+              holds basic x basic + basic + basic without overflow
+ */
+#ifdef EXTENDED_INTEGER_LIMB_64
+typedef uint64_t            extended_integer_basic_type;
+typedef unsigned __int128   extended_integer_double_type;
+#else
+typedef uint32_t            extended_integer_basic_type;
+typedef uint64_t            extended_integer_double_type;
+#endif
 
 /*!
    @typedef extended_integer_basic_type_array
@@ -70,6 +108,12 @@ typedef extended_integer_basic_type *extended_integer_basic_type_array;
  */
 #define EXT_TYPE    extended_integer_basic_type
 
+/*!
+    @name EXT_DOUBLE_TYPE
+    @abstract used to abbr extended_integer_double_type
+ */
+#define EXT_DOUBLE_TYPE extended_integer_double_type
+
 /*!
     @name EXT_ARRAY
     @abstract used to abbr extended_integer_basic_type_array
@@ -82,22 +126,39 @@ typedef extended_integer_basic_type *extended_integer_basic_type_array;
     @name EXT_PRI ?
     @abstract printf specifier for EXT_TYPE [ note only unsigned type is correct form ]
  */
+#ifdef EXTENDED_INTEGER_LIMB_64
+#define EXT_PRId    PRId64
+#define EXT_PRIi    PRIi64
+#define EXT_PRIo    PRIo64
+#define EXT_PRIu    PRIu64
+#define EXT_PRIx    PRIx64
+#define EXT_PRIX    PRIX64
+#else
 #define EXT_PRId    PRId32
 #define EXT_PRIi    PRIi32
 #define EXT_PRIo    PRIo32
 #define EXT_PRIu    PRIu32
 #define EXT_PRIx    PRIx32
 #define EXT_PRIX    PRIX32
+#endif
 
 /*!
     @name EXT_SCN ?
     @abstract scanf specifier for EXT_TYPE [ note only unsigned type is correct form ]
  */
+#ifdef EXTENDED_INTEGER_LIMB_64
+#define EXT_SCNd    SCNd64
+#define EXT_SCNi    SCNi64
+#define EXT_SCNo    SCNo64
+#define EXT_SCNu    SCNu64
+#define EXT_SCNx    SCNx64
+#else
 #define EXT_SCNd    SCNd32
 #define EXT_SCNi    SCNi32
 #define EXT_SCNo    SCNo32
 #define EXT_SCNu    SCNu32
 #define EXT_SCNx    SCNx32
+#endif
 
 #pragma mark Type Info Macro
 
@@ -105,17 +166,29 @@ typedef extended_integer_basic_type *extended_integer_basic_type_array;
     @name EXT_BIT
     @abstract bits of each basic type
  */
+#ifdef EXTENDED_INTEGER_LIMB_64
+#define EXT_BIT     64
+#else
 #define EXT_BIT     32
+#endif
 
 /*!
    @name EXT_MAX
    @abstract max value for EXT_TYPE
 */
+#ifdef EXTENDED_INTEGER_LIMB_64
+#define EXT_MAX     ((EXT_TYPE)(UINT64_MAX))
+#else
 #define EXT_MAX     ((EXT_TYPE)(UINT32_MAX))
+#endif
 
 #pragma mark Help Macro
 
+#ifdef EXTENDED_INTEGER_LIMB_64
+#define EXT_TYPE_C(value) UINT64_C(value)
+#else
 #define EXT_TYPE_C(value) UINT32_C(value)
+#endif
 
 /*!
     @name EXT_ARRAY_SIZE_FOR_BIT
@@ -158,6 +231,22 @@ void extended_integer_copy(EXT_ARRAY _Nonnull restrict array,
                            EXT_ARRAY _Nonnull restrict result,
                            size_t length);
 
+/*!
+   @function extended_integer_used_length
+   @abstract amount of elements up to the highest non-zero one, zero if array is all zero
+   @discussion passing it as length to other functions only touches significand elements,
+               keep one more element if the result could grow
+*/
+size_t extended_integer_used_length(EXT_ARRAY _Nonnull array,
+                                    size_t length);
+
+/*!
+   @function extended_integer_bit_length
+   @abstract highest non-zero bit index plus one, zero if array is all zero
+*/
+size_t extended_integer_bit_length(EXT_ARRAY _Nonnull array,
+                                   size_t length);
+
 #pragma mark - Standard Operation
 
 /*!
@@ -208,6 +297,21 @@ void extended_integer_divide(EXT_ARRAY _Nonnull parm1,
                              size_t length,
                              bool * _Nullable error_flag);
 
+/*!
+    @function extended_integer_divide_modulo
+    @abstract quotient = parm1 / parm2, remainder = parm1 % parm2
+    @discussion divide zero result in zero and runtime breakpoint
+    @param quotient if not NULL, quotient is stored, could be parm1
+    @param remainder if not NULL, remainder is stored, could be parm1
+    @param length should not be zero
+*/
+void extended_integer_divide_modulo(EXT_ARRAY _Nonnull parm1,
+                                    EXT_ARRAY _Nonnull parm2,
+                                    EXT_ARRAY _Nullable quotient,
+                                    EXT_ARRAY _Nullable remainder,
+                                    size_t length,
+                                    bool * _Nullable error_flag);
+
 #pragma mark - Bit Operation
 
 /*!
@@ -230,6 +334,18 @@ void extended_integer_set_bit(EXT_ARRAY _Nonnull array,
                               size_t bit_index,
                               bool value);
 
+/*!
+   @function extended_integer_set_uint64
+   @abstract replace bits [ bit_index, bit_index + 64 ) by value, whole limb at a time
+   @param length should not be zero
+   @param bit_index begin at index zero
+   @discussion bits of value beyond the array are dropped
+*/
+void extended_integer_set_uint64(EXT_ARRAY _Nonnull array,
+                                 size_t length,
+                                 size_t bit_index,
+                                 uint64_t value);
+
 void extended_integer_bit_offset(EXT_ARRAY _Nonnull restrict array,
                                  EXT_ARRAY _Nonnull restrict result,
                                  size_t length,
@@ -244,10 +360,23 @@ void extended_integer_bit_offset(EXT_ARRAY _Nonnull restrict array,
     @param length should not be zero
 */
 void extended_integer_quick_multiply(EXT_ARRAY _Nonnull array,
-                                     uint32_t value,
+                                     EXT_TYPE value,
                                      size_t length,
                                      bool * _Nullable overflow);
 
+/*!
+    @function extended_integer_quick_multiply_add
+    @abstract result = array x value + addend
+    @discussion [ overflow ] will round off like C standard
+    @param length should not be zero
+*/
+void extended_integer_quick_multiply_add(EXT_ARRAY _Nonnull array,
+                                         EXT_TYPE value,
+                                         EXT_ARRAY _Nonnull addend,
+                                         EXT_ARRAY _Nonnull restrict result,
+                                         size_t length,
+                                         bool * _Nullable overflow);
+
 /*!
     @function extended_integer_quick_divide_modulo
     @param dividend after calculation the reminder is stored in it
@@ -257,19 +386,38 @@ void extended_integer_quick_multiply(EXT_ARRAY _Nonnull array,
     @result quotient of the operation, it is valid if error_flag stored false
     @abstract used for quick modulo operation taken digits out of current base exponent level
     @discussion [ 1 ] when divisor is zero, all operation is cancelled, zero returned, error_flag set to true
-                [ 2 ] when result is larger than uint32_t could store, result is overflow like C style, error_flag set to true
+                [ 2 ] when result is larger than EXT_TYPE could store, result is overflow like C style, error_flag set to true
  */
-uint32_t extended_integer_quick_divide_modulo(EXT_ARRAY _Nonnull restrict dividend,
+EXT_TYPE extended_integer_quick_divide_modulo(EXT_ARRAY _Nonnull restrict dividend,
                                               EXT_ARRAY _Nonnull restrict divisor,
                                               size_t length,
                                               bool * _Nullable error_flag);
 
+/*!
+    @function extended_integer_pow_uint32
+    @abstract result = base ^ exponent by square and multiply, O(log exponent) multiplications
+    @discussion [ overflow ] will round off like C standard, also set if scratch arena is full
+    @param length should not be zero
+ */
+void extended_integer_pow_uint32(uint32_t base,
+                                 uint32_t exponent,
+                                 EXT_ARRAY _Nonnull result,
+                                 size_t length,
+                                 bool * _Nullable overflow);
+
 #pragma mark - DEBUG
 
 #ifdef DEBUG
 
 void extended_integer_debug(EXT_ARRAY _Nullable array, size_t length);
 
+/*!
+    @function extended_integer_multiply_benchmark
+    @abstract time schoolbook against one level of Karatsuba for growing element amount,
+              print the table and the suggested EXTENDED_INTEGER_KARATSUBA_THRESHOLD
+ */
+void extended_integer_multiply_benchmark(void);
+
 #endif
 
 #endif /* extended_integer_h */
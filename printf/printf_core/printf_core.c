@@ -34,6 +34,7 @@
 
 #include <stdio.h>
 #include <float.h>
+#include <stdlib.h>
 #include <wchar.h>
 #include <limits.h>
 #include <stdarg.h>
@@ -44,6 +45,7 @@
 #include "printf_core.h"
 #include "string_type.h"
 #include "extended_integer.h"
+#include "scratch_arena.h"
 
 #pragma mark - Macro
 
@@ -87,6 +89,45 @@
 */
 #define PRINTF_FLOATING_POINT_SPECIFIER_A_UNSPECIFIED_PRECISION_OUTPUT_NEEDED
 
+#pragma mark floating point shortest digits
+
+/*!
+    @name PRINTF_FLOATING_POINT_SHORTEST_FAST_PATH
+    @discussion shortest digits of normal binary 64 for [fFeEgG] specifier are generated from
+                125 bit power of 5 tables with 128 bit arithmetic instead of extended_integer,
+                normal binary 32 [h length] from the high 64 bit of the same tables with 64 bit arithmetic,
+                used only where they are the exact value rounded [ up to 15 or 6 significant digits ],
+                others are rounded from exact digits, output is the same
+    @author you may choose to #define or #undef it
+*/
+#define PRINTF_FLOATING_POINT_SHORTEST_FAST_PATH
+
+/*!
+    @name PRINTF_FLOATING_POINT_FIXED_FAST_PATH
+    @discussion [fFeE] of binary 64 with precision up to 17 [21 of 80 bit, 36 of binary 128] are rounded once from the exact value
+                with 128 bit arithmetic [extended_integer for far exponent of e], ties to even like glibc,
+                instead of rounding the shortest digits again, others are rounded from exact digits of extended_integer
+    @author you may choose to #define or #undef it
+*/
+#define PRINTF_FLOATING_POINT_FIXED_FAST_PATH
+
+/*!
+    @name PRINTF_FLOATING_POINT_LONG_DOUBLE_80
+    @discussion [L] length long double is kept as x87 80 bit extended precision where long double is one,
+                instead of converting it to binary 64 [11 significand bits lost],
+                [fFeE] with precision up to 21 share the 128 bit fixed precision path of binary 64
+    @author you may choose to #define or #undef it
+*/
+#define PRINTF_FLOATING_POINT_LONG_DOUBLE_80
+
+#pragma mark floating point value
+
+/*!
+    @name PRINTF_FLOATING_POINT_VALUE_FORMAT_SIZE
+    @discussion max bytes of the single conversion format taken by CA_format_float and CA_format_float128 [ null-character included ]
+ */
+#define PRINTF_FLOATING_POINT_VALUE_FORMAT_SIZE     64
+
 #pragma mark string type
 
 /*!
@@ -97,6 +138,31 @@
 */
 #define PRINTF_ENABLE_NULL_STRING_OUTPUT
 
+#pragma mark format cache
+
+/*!
+    @name PRINTF_FORMAT_CACHE_ENABLE
+    @discussion CA_snprintf, CA_fprintf and CA_printf look up a compiled format keyed by
+                the format address, formats from string literal are address-stable
+                the cache is fixed-size static storage and never allocates, a hit compares the content
+                as well, a slot is only replaced when the same address misses twice in a row,
+                a busy slot or a missed format is formatted directly without the cache
+    @author you may choose to #define or #undef it
+*/
+#define PRINTF_FORMAT_CACHE_ENABLE
+
+/*!
+    @name PRINTF_FORMAT_CACHE_SIZE
+    @discussion entry amount for the format cache, should be power of 2
+*/
+#define PRINTF_FORMAT_CACHE_SIZE            256
+
+/*!
+    @name PRINTF_FORMAT_CACHE_ENTRY_SIZE
+    @discussion bytes of each entry for the compiled format, a larger one is not cached
+*/
+#define PRINTF_FORMAT_CACHE_ENTRY_SIZE      1024
+
 #pragma mark printf limit
 
 /*!
@@ -105,12 +171,25 @@
  */
 #define PRINTF_INTEGER_MAX_DIGITS_AMOUNT    1024
 
+/*!
+    @name PRINTF_INTEGER_BUFFER_SIZE
+    @discussion local buffer for d i o u x X specifier, uintmax_t digits in octal plus sign or prefix
+ */
+#define PRINTF_INTEGER_BUFFER_SIZE          32
+
 /*!
     @name PRINTF_PRECISON_LIMIT
     @discussion this is a vague limit and may not be valid
  */
 #define PRINTF_PRECISON_LIMIT               1024
 
+/*!
+    @name PRINTF_FILE_STAGING_BUFFER_SIZE
+    @discussion staging buffer size for FILE output, formatted bytes are spilled
+                to the stream only when this is full or the call finishes
+ */
+#define PRINTF_FILE_STAGING_BUFFER_SIZE     1024
+
 /*!
    @name PRINTF_CHAR_VALUE_MAX
    @discussion max value for reading from int type specifier [ %c ]
@@ -150,6 +229,7 @@
 #define CHARACTER_N             0x4E
 #define CHARACTER_P             0x50
 #define CHARACTER_L             0x4C
+#define CHARACTER_Q             0x51
 #define CHARACTER_X             0x58
 #define CHARACTER_a             0x61
 #define CHARACTER_b             0x62
@@ -187,11 +267,20 @@
 #define UTF8Mask11111110(mask) (!(((UTF8Char)(1 << 0)) & (mask)))
 #define UTF8AllBitTest(value)  (!((~((UTF8Char)0)) ^ ((UTF8Char)(value))))
 
-#pragma mark stack allocation
+#pragma mark scratch allocation
 
-#define PRINTF_STACK_ALLOCATION_LIMIT   1024
+/*!
+    @name PRINTF_SCRATCH_ALLOCATION_LIMIT
+    @discussion max element amount of a single temporary buffer, such as digits for %f,
+                storage comes from scratch arena of calling thread instead of stack
+ */
+#define PRINTF_SCRATCH_ALLOCATION_LIMIT     65536
 
-#define printf_stack_alloc(size) __builtin_alloca(size)
+/*!
+    @name printf_scratch_alloc
+    @abstract released when leaving the function which declared SCRATCH_ARENA_SCOPE, NULL if arena is full
+ */
+#define printf_scratch_alloc(size) scratch_arena_alloc(size)
 
 #pragma mark error handle
 
@@ -217,6 +306,57 @@
   #define PRINTF_LITTLE_ENDIAN
 #endif
 
+#pragma mark FILE locking
+
+#if defined __GLIBC__
+  #define printf_fwrite_unlocked(ptr, size, n, stream) fwrite_unlocked(ptr, size, n, stream)
+#else
+  // stream is already locked by flockfile, and the lock is recursive
+  #define printf_fwrite_unlocked(ptr, size, n, stream) fwrite(ptr, size, n, stream)
+#endif
+
+#pragma mark floating point shortest digits
+
+#if defined PRINTF_FLOATING_POINT_SHORTEST_FAST_PATH && defined __SIZEOF_INT128__
+  #define PRINTF_FLOATING_POINT_SHORTEST_64
+#endif
+
+#ifdef PRINTF_FLOATING_POINT_SHORTEST_FAST_PATH
+  #define PRINTF_FLOATING_POINT_SHORTEST_32
+#endif
+
+#if defined PRINTF_FLOATING_POINT_FIXED_FAST_PATH && defined __SIZEOF_INT128__
+  #define PRINTF_FLOATING_POINT_FIXED_64
+#endif
+
+#pragma mark long double
+
+#if defined PRINTF_FLOATING_POINT_LONG_DOUBLE_80 && (defined __x86_64__ || defined __i386__) && LDBL_MANT_DIG == 64
+  #define PRINTF_FLOATING_POINT_80
+#endif
+
+#pragma mark binary 128
+
+#if defined __SIZEOF_FLOAT128__ && defined __SIZEOF_INT128__
+  #define PRINTF_FLOATING_POINT_128
+#endif
+
+#pragma mark literal span kernel
+
+#if defined __GNUC__ && defined __SSE2__ && (defined __x86_64__ || defined __i386__)
+  #define PRINTF_LITERAL_SPAN_X86
+  #include <immintrin.h>
+#endif
+
+#if defined __has_attribute
+  #if __has_attribute(no_sanitize)
+    #define PRINTF_NO_SANITIZE_ADDRESS __attribute__((no_sanitize("address")))
+  #endif
+#endif
+#ifndef PRINTF_NO_SANITIZE_ADDRESS
+  #define PRINTF_NO_SANITIZE_ADDRESS
+#endif
+
 #pragma mark - static storage
 
 static const UTF8Char base8_character[] = {
@@ -230,6 +370,32 @@ static const UTF8Char base10_character[] = {
     CHARACTER_8,    CHARACTER_9
 };
 
+static const UTF8Char base10_pair_character[200] = {
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+};
+
+static const uint64_t base10_power_uint64[] = {
+    UINT64_C(1),                    UINT64_C(10),
+    UINT64_C(100),                  UINT64_C(1000),
+    UINT64_C(10000),                UINT64_C(100000),
+    UINT64_C(1000000),              UINT64_C(10000000),
+    UINT64_C(100000000),            UINT64_C(1000000000),
+    UINT64_C(10000000000),          UINT64_C(100000000000),
+    UINT64_C(1000000000000),        UINT64_C(10000000000000),
+    UINT64_C(100000000000000),      UINT64_C(1000000000000000),
+    UINT64_C(10000000000000000),    UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000),  UINT64_C(10000000000000000000)
+};
+
 static const UTF8Char base16_character_lowercase[] = {
     CHARACTER_0,    CHARACTER_1,    CHARACTER_2,    CHARACTER_3,
     CHARACTER_4,    CHARACTER_5,    CHARACTER_6,    CHARACTER_7,
@@ -529,63 +695,44 @@ static bool printf_UTF32Str_to_UTF8Char(UTF32Str _Nonnull str,
 #pragma mark UTF8 Validation
 
 /*!
-    @function printf_utf8_validate
-    @param string a pointer to UTF8 string for validation
-    @discussion it is safe to pass non-UTF8 encoding string [ null-terminated ]
-    @param count if not NULL when return true we store the actual UTF8 character count into it
-    @return true if a valid UTF8 string
+    @function printf_UTF8_sequence_length_inline
+    @param current point to a non-null byte of a null-terminated string
+    @return byte length of the UTF8 sequence starting at current, 0 if malformed
+    @discussion a continuation byte never matches the null-character, so reading stops at it
+ */
+static inline size_t printf_UTF8_sequence_length_inline(const UTF8Char * _Nonnull current) {
+    size_t length;
+    if(UTF8Mask0(current[0])) return 1;
+    else if(UTF8Mask10(current[0])) return 0;
+    else if(UTF8AllBitTest(current[0])) return 0;
+    else if(UTF8Mask110(current[0])) length = 2;        // 110xxxxx 10xxxxxx
+    else if(UTF8Mask1110(current[0])) length = 3;       // 1110xxxx 10xxxxxx 10xxxxxx
+    else if(UTF8Mask11110(current[0])) length = 4;      // 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+    else if(UTF8Mask111110(current[0])) length = 5;     // 111110xx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
+    else if(UTF8Mask1111110(current[0])) length = 6;    // 1111110x 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
+    else if(UTF8Mask11111110(current[0])) length = 7;   // 11111110 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
+    ELSE_DEVELOP_BREAKPOINT_RETURN(0);
+    for(size_t index = 1; index < length; index++)
+        if(UTF8Mask0(current[index]) || !UTF8Mask10(current[index])) return 0;
+    return length;
+}
+
+/*!
+    @function printf_UTF8Span_validate
+    @abstract same as printf_UTF8Str_validate, but only for the first length bytes
+    @discussion string must still be null-terminated, a sequence crossing the end is malformed
+                as long as string[length] is an ASCII character
  */
-static bool printf_UTF8Str_validate(const UTF8Char * _Nonnull string, size_t * _Nullable count) {
+static bool printf_UTF8Span_validate(const UTF8Char * _Nonnull string, size_t length) {
     if(string != NULL) {
-        size_t internal_count = 0;
         const UTF8Char * _Nonnull current = string;
-        while (current[0] != CHARACTER_null)
-            if(UTF8Mask0(current[0])) { current++; internal_count++; }
-            else if(UTF8Mask10(current[0])) return false;
-            else if(UTF8AllBitTest(current[0])) return false;
-            else if(UTF8Mask110(current[0])) {  // 110xxxxx 10xxxxxx
-                // this test make sure match 10xxxxxx, no need to test null-existance
-                if(UTF8Mask0(current[1]) || !UTF8Mask10(current[1])) return false;
-                current += 2; internal_count++;
-            }
-            else if(UTF8Mask1110(current[0])) {  // 1110xxxx 10xxxxxx 10xxxxxx
-                if(UTF8Mask0(current[1]) || !UTF8Mask10(current[1])) return false;
-                if(UTF8Mask0(current[2]) || !UTF8Mask10(current[2])) return false;
-                current += 3; internal_count++;
-            }
-            else if(UTF8Mask11110(current[0])) {  // 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-                if(UTF8Mask0(current[1]) || !UTF8Mask10(current[1])) return false;
-                if(UTF8Mask0(current[2]) || !UTF8Mask10(current[2])) return false;
-                if(UTF8Mask0(current[3]) || !UTF8Mask10(current[3])) return false;
-                current += 4; internal_count++;
-            }
-            else if(UTF8Mask111110(current[0])) {  // 111110xx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
-                if(UTF8Mask0(current[1]) || !UTF8Mask10(current[1])) return false;
-                if(UTF8Mask0(current[2]) || !UTF8Mask10(current[2])) return false;
-                if(UTF8Mask0(current[3]) || !UTF8Mask10(current[3])) return false;
-                if(UTF8Mask0(current[4]) || !UTF8Mask10(current[4])) return false;
-                current += 5; internal_count++;
-            }
-            else if(UTF8Mask1111110(current[0])) {  // 1111110x 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
-                if(UTF8Mask0(current[1]) || !UTF8Mask10(current[1])) return false;
-                if(UTF8Mask0(current[2]) || !UTF8Mask10(current[2])) return false;
-                if(UTF8Mask0(current[3]) || !UTF8Mask10(current[3])) return false;
-                if(UTF8Mask0(current[4]) || !UTF8Mask10(current[4])) return false;
-                if(UTF8Mask0(current[5]) || !UTF8Mask10(current[5])) return false;
-                current += 6; internal_count++;
-            }
-            else if(UTF8Mask11111110(current[0])) {  // 11111110 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx 10xxxxxx
-                if(UTF8Mask0(current[1]) || !UTF8Mask10(current[1])) return false;
-                if(UTF8Mask0(current[2]) || !UTF8Mask10(current[2])) return false;
-                if(UTF8Mask0(current[3]) || !UTF8Mask10(current[3])) return false;
-                if(UTF8Mask0(current[4]) || !UTF8Mask10(current[4])) return false;
-                if(UTF8Mask0(current[5]) || !UTF8Mask10(current[5])) return false;
-                if(UTF8Mask0(current[6]) || !UTF8Mask10(current[6])) return false;
-                current += 7; internal_count++;
-            }
-            ELSE_DEVELOP_BREAKPOINT_RETURN(false);
-        if(count != NULL) count[0] = internal_count;
-        return true;
+        const UTF8Char * _Nonnull end = string + length;
+        while (current < end) {
+            size_t sequence = printf_UTF8_sequence_length_inline(current);
+            if(sequence == 0) return false;
+            current += sequence;
+        }
+        return current == end;
     } DEBUG_ELSE
     return false;
 }
@@ -663,6 +810,17 @@ typedef enum printf_type {
     printf_type_FILE,
 } printf_type;
 
+/*!
+    @enum printf_format_validation
+    @discussion format is UTF8 validated along with output, pending means only the bytes
+                before core->format are known to be valid
+*/
+typedef enum printf_format_validation {
+    printf_format_validation_pending,
+    printf_format_validation_valid,
+    printf_format_validation_malformed,
+} printf_format_validation;
+
 /*!
     @struct printf_core
     @arg format printf_style format string encoded in UTF8
@@ -678,16 +836,22 @@ struct printf_core {
             size_t count;       // provided store count, if store is NULL,
                                 // this should be zero
             size_t index;       // current store index,
-                                // only when index + 1 < count
-                                // store could be performed
-                                // everytime it is point to the null-character
-                                // null-terminate pending should always
                                 // index should always be (index < count || index == count == 0)
+            size_t remain;      // payload bytes could still be stored,
+                                // one byte is always kept for the null-character
+                                // which is only written by printf_core_output_finalize_inline
             UTF8Char * _Nullable store;
         } string;
-        FILE * _Nonnull file;   // assigned file output buffer
+        struct {
+            FILE * _Nonnull stream;     // assigned file output stream
+            UTF8Char * _Nonnull buffer; // staging buffer, only spilled to
+                                        // stream when full or finalized
+            size_t count;               // staging buffer capacity
+            size_t index;               // staged byte amount
+        } file;
     } output;
     size_t actual_need; // return value for snprintf, not counting the terminate null character
+    printf_format_validation validation;    // FILE output is only spilled once format is valid
     
 #ifdef DEBUG        // used for debug perpose
     const UTF8Char * _Nonnull original_format;
@@ -722,7 +886,8 @@ static bool printf_core_validate(printf_core_ref _Nonnull core) {
                 }
                 break;
             case printf_type_FILE:
-                if(core->output.file == NULL) {
+                if(core->output.file.stream == NULL || core->output.file.buffer == NULL ||
+                   core->output.file.count == 0 || core->output.file.index > core->output.file.count) {
                     DEBUG_RETURN(false);
                 }
                 break;
@@ -741,15 +906,128 @@ static bool printf_core_validate(printf_core_ref _Nonnull core) {
 static inline void printf_core_output_initialize_inline(printf_core_ref _Nonnull core) {
     if(core != NULL) {
         if(core->type == printf_type_string) {
-            if(core->output.string.store != NULL) {
-                if(core->output.string.count >= 1)
-                    core->output.string.store[0] = CHARACTER_null;
-                else
-                    core->output.string.store = NULL;  // optimized
-            }
+            if(core->output.string.store != NULL && core->output.string.count == 0)
+                core->output.string.store = NULL;  // optimized
             core->output.string.index = 0;
+            core->output.string.remain = 0;
+            if(core->output.string.store != NULL)
+                core->output.string.remain = core->output.string.count - 1;
+            core->actual_need = 0;
+        }
+        else if(core->type == printf_type_FILE) {
+            flockfile(core->output.file.stream);
+            core->output.file.index = 0;
             core->actual_need = 0;
         }
+        core->validation = printf_format_validation_pending;
+    } DEBUG_ELSE
+}
+
+static bool printf_format_validate(const UTF8Char * _Nonnull format);
+
+/*!
+    @function printf_core_format_validation_resolve
+    @abstract validate the rest of the format if not yet done
+    @discussion the part before core->format is already parsed when output is produced
+    @return true if the whole format is valid
+*/
+static bool printf_core_format_validation_resolve(printf_core_ref _Nonnull core) {
+    if(core != NULL) {
+        if(core->validation == printf_format_validation_pending)
+            core->validation = printf_format_validate(core->format) ?
+                printf_format_validation_valid : printf_format_validation_malformed;
+        return core->validation == printf_format_validation_valid;
+    } DEBUG_ELSE
+    return false;
+}
+
+/*!
+    @function printf_core_file_spill_inline
+    @abstract write all staged bytes to the stream
+    @discussion stream should be locked by printf_core_output_initialize_inline
+*/
+static inline void printf_core_file_spill_inline(printf_core_ref _Nonnull core) {
+    if(core != NULL && core->type == printf_type_FILE) {
+        if(core->output.file.index > 0) {
+            if(printf_core_format_validation_resolve(core))     // nothing is written for malformed format
+                printf_fwrite_unlocked(core->output.file.buffer, sizeof(UTF8Char),
+                                       core->output.file.index, core->output.file.stream);
+            core->output.file.index = 0;
+        }
+    } DEBUG_ELSE
+}
+
+/*!
+    @function printf_core_file_put_inline
+    @abstract stage one byte for FILE output, actual_need is not counted
+*/
+static inline void printf_core_file_put_inline(printf_core_ref _Nonnull core, UTF8Char byte) {
+    if(core->output.file.index == core->output.file.count)
+        printf_core_file_spill_inline(core);
+    core->output.file.buffer[core->output.file.index++] = byte;
+}
+
+/*!
+    @function printf_core_file_write
+    @abstract stage bytes for FILE output, actual_need is not counted
+    @discussion byte run larger than the whole staging buffer is written through
+*/
+static void printf_core_file_write(printf_core_ref _Nonnull core, const UTF8Char * _Nonnull str, size_t length) {
+    if(core != NULL && str != NULL) {
+        size_t available = core->output.file.count - core->output.file.index;
+        if(length > available) {
+            __builtin_memcpy(core->output.file.buffer + core->output.file.index, str, available);
+            core->output.file.index += available;
+            str += available; length -= available;
+            printf_core_file_spill_inline(core);
+            if(length >= core->output.file.count) {
+                if(printf_core_format_validation_resolve(core))
+                    printf_fwrite_unlocked(str, sizeof(UTF8Char), length, core->output.file.stream);
+                return;
+            }
+        }
+        __builtin_memcpy(core->output.file.buffer + core->output.file.index, str, length);
+        core->output.file.index += length;
+    } DEBUG_ELSE
+}
+
+/*!
+    @function printf_core_file_fill
+    @abstract stage count copies of byte for FILE output, actual_need is not counted
+*/
+static void printf_core_file_fill(printf_core_ref _Nonnull core, UTF8Char byte, size_t count) {
+    if(core != NULL) {
+        LOOP {
+            size_t available = core->output.file.count - core->output.file.index;
+            size_t fill_amount = count < available ? count : available;
+            __builtin_memset(core->output.file.buffer + core->output.file.index, byte, fill_amount);
+            core->output.file.index += fill_amount;
+            count -= fill_amount;
+            if(count == 0) break;
+            printf_core_file_spill_inline(core);
+        }
+    } DEBUG_ELSE
+}
+
+/*!
+    @function printf_core_output_finalize_inline
+    @abstract must be paired with printf_core_output_initialize_inline, even on error
+    @discussion string output is null-terminated here only once
+*/
+static inline void printf_core_output_finalize_inline(printf_core_ref _Nonnull core) {
+    if(core != NULL) {
+        if(core->type == printf_type_string) {
+            if(core->output.string.store != NULL) {
+                DEBUG_ASSERT(core->output.string.index < core->output.string.count);
+                core->output.string.store[core->output.string.index] = CHARACTER_null;
+            }
+        }
+        else if(core->type == printf_type_FILE) {
+            if(core->validation == printf_format_validation_malformed)
+                core->output.file.index = 0;    // drop staged bytes
+            printf_core_file_spill_inline(core);
+            funlockfile(core->output.file.stream);
+        }
     } DEBUG_ELSE
 }
 
@@ -783,13 +1061,14 @@ static void printf_core_error_handle(printf_core_ref _Nonnull core) {
           di                  uoxX                        fFeEgGaA        c           s           p           n
  (none)   int                 unsigned int                double          int         char *      void *      int *
  hh       signed char         unsigned char                                                                   signed char *
- h        short int           unsigned short int                                                              short int *
+ h        short int           unsigned short int          float [double]                                      short int *
  l        long int            unsigned long int           double          wint_t      wchar_t *               long int *
  ll       long long int       unsigned long long int                                                          long long int *
  j        intmax_t            uintmax_t                                                                       intmax_t *
  z        size_t              size_t                                                                          size_t *
  t        ptrdiff_t           ptrdiff_t                                                                       ptrdiff_t *
  L                                                        long double
+ Q                                                        __float128          [libquadmath]
  
  [ .precision ]
  A precision of 0 means that no character is written for the value 0
@@ -851,7 +1130,8 @@ typedef enum printf_interprate_length_type {
     printf_interprate_length_j,
     printf_interprate_length_z,
     printf_interprate_length_t,
-    printf_interprate_length_L
+    printf_interprate_length_L,
+    printf_interprate_length_Q
 } printf_interprate_length_type;
 
 struct printf_interprate {
@@ -1005,302 +1285,257 @@ static inline printf_specifier_type printf_interprate_check_specifier_byte_inlin
 }
 
 /*!
-    @function printf_interprate_search_specifier_inline
-    @param escape string point to escape character start which means escape[0] == CHARACTER_percentage
-    @param specifier_byte used to store the specifer type if not return NULL
-    @abstract search for an interprate specifier character
+    @enum printf_interprate_class
+    @discussion character class of a format byte inside an interprate
 */
-static inline const UTF8Char * _Nullable printf_interprate_search_specifier_inline(const UTF8Char * _Nonnull escape,
-                                                                                   printf_specifier_type * _Nullable specifier_byte) {
-    if(escape != NULL && escape[0] == CHARACTER_percentage) {
-        escape += 1;
-        printf_specifier_type current_type;
-        while (escape[0] != CHARACTER_null)
-            if((current_type = printf_interprate_check_specifier_byte_inline(escape[0])) != printf_specifier_invalid) {
-                if(specifier_byte != NULL) specifier_byte[0] = current_type;
-                return escape;
-            }
-            else escape++;
-    } DEBUG_ELSE
-    return NULL;
-}
+typedef enum printf_interprate_class {
+    printf_interprate_class_invalid = 0,    // include null-character and non-ASCII bytes
+    printf_interprate_class_flag,           // - + (space) #
+    printf_interprate_class_zero,           // flag or digit by position
+    printf_interprate_class_digit,          // 1 - 9
+    printf_interprate_class_dot,
+    printf_interprate_class_asterisk,
+    printf_interprate_class_length,         // h l j z t L Q
+    printf_interprate_class_specifier
+} printf_interprate_class;
+
+static const uint8_t printf_interprate_class_table[256] = {
+    [CHARACTER_minus] = printf_interprate_class_flag,
+    [CHARACTER_plus] = printf_interprate_class_flag,
+    [CHARACTER_space] = printf_interprate_class_flag,
+    [CHARACTER_hash] = printf_interprate_class_flag,
+    [CHARACTER_0] = printf_interprate_class_zero,
+    [CHARACTER_1 ... CHARACTER_9] = printf_interprate_class_digit,
+    [CHARACTER_dot] = printf_interprate_class_dot,
+    [CHARACTER_asterisk] = printf_interprate_class_asterisk,
+    [CHARACTER_h] = printf_interprate_class_length,
+    [CHARACTER_l] = printf_interprate_class_length,
+    [CHARACTER_j] = printf_interprate_class_length,
+    [CHARACTER_z] = printf_interprate_class_length,
+    [CHARACTER_t] = printf_interprate_class_length,
+    [CHARACTER_L] = printf_interprate_class_length,
+    [CHARACTER_Q] = printf_interprate_class_length,
+    [CHARACTER_d] = printf_interprate_class_specifier,
+    [CHARACTER_i] = printf_interprate_class_specifier,
+    [CHARACTER_u] = printf_interprate_class_specifier,
+    [CHARACTER_o] = printf_interprate_class_specifier,
+    [CHARACTER_x] = printf_interprate_class_specifier,
+    [CHARACTER_X] = printf_interprate_class_specifier,
+    [CHARACTER_f] = printf_interprate_class_specifier,
+    [CHARACTER_F] = printf_interprate_class_specifier,
+    [CHARACTER_e] = printf_interprate_class_specifier,
+    [CHARACTER_E] = printf_interprate_class_specifier,
+    [CHARACTER_g] = printf_interprate_class_specifier,
+    [CHARACTER_G] = printf_interprate_class_specifier,
+    [CHARACTER_a] = printf_interprate_class_specifier,
+    [CHARACTER_A] = printf_interprate_class_specifier,
+    [CHARACTER_c] = printf_interprate_class_specifier,
+    [CHARACTER_s] = printf_interprate_class_specifier,
+    [CHARACTER_p] = printf_interprate_class_specifier,
+    [CHARACTER_n] = printf_interprate_class_specifier,
+    [CHARACTER_percentage] = printf_interprate_class_specifier,
+};
 
 /*!
-    @function printf_interprate_length_parsing
-    @abstract parsing interprate length field
-    @discussion according to the parsingPoint [specifier] and format [% character] only affect [length] field
-                if no length field found return true and not affect anything
-    @param interprate if parsing success, it is used to store result
-    @param format point to the escape character (%)
-    @param parsingPoint point to the actual specifier, if return true, this is updated to the next parsing point
-    @return true if parsing success, even no length field; false if encounter some illegal character
+    @enum printf_interprate_state
+    @discussion parsing state, fields can only be given in order [flag][width][.precision][length]
 */
-static bool printf_interprate_length_parsing(printf_interprate_ref _Nonnull interprate,
-                                             const UTF8Char * _Nonnull format,
-                                             const UTF8Char * _Nonnull * _Nonnull parsingPoint) {
-    if(interprate != NULL && format != NULL && parsingPoint != NULL && parsingPoint[0] != NULL && format < parsingPoint[0] && format[0] == CHARACTER_percentage) {
-        printf_specifier_type specifier_type;
-        const UTF8Char * _Nonnull current = parsingPoint[0];
-        if((specifier_type = printf_interprate_check_specifier_byte_inline(current[0])) != printf_specifier_invalid) {
-            switch (specifier_type) {
-                case printf_specifier_d_or_i:
-                case printf_specifier_u:
-                case printf_specifier_o:
-                case printf_specifier_x:
-                case printf_specifier_X:
-                case printf_specifier_n: {
-                    bool found_length_type = false;
-                    // when set found_length_type, it is responsible to set current as well
-                    if(current >= format + 3) {
-                        found_length_type = true;
-                        if(current[-1] == CHARACTER_h && current[-2] == CHARACTER_h)
-                            interprate->length_type = printf_interprate_length_hh;
-                        else if(current[-1] == CHARACTER_l && current[-2] == CHARACTER_l)
-                            interprate->length_type = printf_interprate_length_ll;
-                        else found_length_type = false;
-                        if(found_length_type) current = current - 3;     // lld
-                    }
-                    if(!found_length_type && current >= format + 2) {
-                        found_length_type = true;
-                        if(current[-1] == CHARACTER_h)
-                            interprate->length_type = printf_interprate_length_h;
-                        else if(current[-1] == CHARACTER_l)
-                            interprate->length_type = printf_interprate_length_l;
-                        else if(current[-1] == CHARACTER_j)
-                            interprate->length_type = printf_interprate_length_j;
-                        else if(current[-1] == CHARACTER_z)
-                            interprate->length_type = printf_interprate_length_z;
-                        else if(current[-1] == CHARACTER_t)
-                            interprate->length_type = printf_interprate_length_t;
-                        else found_length_type = false;
-                        if(found_length_type) current = current - 2;     // ld
-                    }
-                    if(!found_length_type) current = current - 1;        // d
-                }
-                    break;
-                    
-                case printf_specifier_f:
-                case printf_specifier_F:
-                case printf_specifier_e:
-                case printf_specifier_E:
-                case printf_specifier_g:
-                case printf_specifier_G:
-                case printf_specifier_a:
-                case printf_specifier_A: {
-                    bool found_length_type = false;
-                    // when set found_length_type, it is responsible to set current as well
-                    if(current >= format + 2) {
-                        found_length_type = true;
-                        if(current[-1] == CHARACTER_L)
-                            interprate->length_type = printf_interprate_length_L;
-                        else if(current[-1] == CHARACTER_l)
-                            interprate->length_type = printf_interprate_length_l;
-                        else found_length_type = false;
-                        if(found_length_type) current = current - 2;     // Lf
-                    }
-                    if(!found_length_type) current = current - 1;        // f
-                }
-                    break;
-                    
-                case printf_specifier_c:
-                case printf_specifier_s:
-                    if(current >= format + 2 && current[-1] == CHARACTER_l) {
-                        interprate->length_type = printf_interprate_length_l;
-                        current = current - 2;
-                    }
-                    else current = current - 1;
-                    break;
-                    
-                // [ no parsing type ]
-                case printf_specifier_p:
-                case printf_specifier_percentage:
-                    current = current - 1;
-                    break;
-                
-                // [ unacceptable result ]
-                case printf_specifier_invalid:
-                default:
-                    DEBUG_RETURN(false);
-            }
-            parsingPoint[0] = current;  // updated parsingPoint
-            return true;
-        } DEVELOP_ELSE_BREAKPOINT
-        // [BREAKPOINT] fund a not valid specifier [not match C99 standard]
-    } DEBUG_ELSE
-    return false;
+typedef enum printf_interprate_state {
+    printf_interprate_state_flag,
+    printf_interprate_state_width,              // inside width digits
+    printf_interprate_state_width_done,         // after width asterisk
+    printf_interprate_state_dot,
+    printf_interprate_state_precision,          // inside precision digits
+    printf_interprate_state_precision_done,     // after precision asterisk
+    printf_interprate_state_length
+} printf_interprate_state;
+
+/*!
+    @function printf_interprate_length_byte_inline
+    @param byte should be in printf_interprate_class_length
+    @param length_type current length, printf_interprate_length_none for the first length byte
+    @return the combined length type, printf_interprate_length_none if not acceptable
+*/
+static inline printf_interprate_length_type printf_interprate_length_byte_inline(const UTF8Char byte,
+                                                                                 printf_interprate_length_type length_type) {
+    if(length_type == printf_interprate_length_none)
+        switch (byte) {
+            case CHARACTER_h: return printf_interprate_length_h;
+            case CHARACTER_l: return printf_interprate_length_l;
+            case CHARACTER_j: return printf_interprate_length_j;
+            case CHARACTER_z: return printf_interprate_length_z;
+            case CHARACTER_t: return printf_interprate_length_t;
+            case CHARACTER_L: return printf_interprate_length_L;
+            case CHARACTER_Q: return printf_interprate_length_Q;
+            default: DEBUG_RETURN(printf_interprate_length_none);
+        }
+    if(length_type == printf_interprate_length_h && byte == CHARACTER_h) return printf_interprate_length_hh;
+    if(length_type == printf_interprate_length_l && byte == CHARACTER_l) return printf_interprate_length_ll;
+    return printf_interprate_length_none;
 }
 
 /*!
-    @function printf_interprate_precision_parsing
-    @abstract parsing interprate precision field
-    @discussion only affect [precision] field
-                if no precision field found return true and not affect anything
-    @param interprate if parsing success, it is used to store result
-    @param format point to the escape character (%)
-    @param parsingPoint point to the precision parsing point, if return true, this is updated to the next parsing point
-    @return true if parsing success, even no length field; false if encounter some illegal character
+    @function printf_interprate_length_acceptable_inline
+    @return true if length_type is listed for specifier_type in the [ length ] table
 */
-static bool printf_interprate_precision_parsing(printf_interprate_ref _Nonnull interprate,
-                                                const UTF8Char * _Nonnull format,
-                                                const UTF8Char * _Nonnull * _Nonnull parsingPoint) {
-    if(interprate != NULL && format != NULL && parsingPoint != NULL && parsingPoint[0] != NULL && format <= parsingPoint[0]) {
-        const UTF8Char * _Nonnull current = parsingPoint[0];
-        for(const UTF8Char *temp = current; temp > format; temp--)
-            if(temp[0] == CHARACTER_dot) {
-                if(temp == current) {       // only dot exist at current parsing point
-                    interprate->precision_type = printf_interprate_adjustment_fix_number;
-                    interprate->precision = 0;
-                    current--;              // valid for this is dot(.) and before format
-                    break;                  // exit precison parsing
-                }
-                if(temp + 1 == current && current[0] == CHARACTER_asterisk) {
-                    interprate->precision_type = printf_interprate_adjustment_waiting_input;
-                    parsingPoint[0] = temp - 1;     // may at most-left to [format]
-                    return true;
-                }
-                
-                // and this dot position is after % mark
-                const UTF8Char * _Nonnull dot_position = temp;
-                
-                // temp < current
-                // temp point to the dot(.) as precision
-                temp++;
-                
-                // temp <= current
-                // temp point to first possible number position for precision parsing
-                // current is the last possible number position for precision parsing
-                size_t precision = 0;
-                while (temp <= current)
-                    if(temp[0] >= CHARACTER_0 && temp[0] <= CHARACTER_9) {
-#ifdef DEBUG
-                        // overflow test for precision field
-                        size_t overflow_test;
-                        if(__builtin_mul_overflow(precision, 10, &overflow_test)) DEBUG_POINT;
-                        if(__builtin_add_overflow(overflow_test, temp[0] - CHARACTER_0, &overflow_test)) DEBUG_POINT;
+static inline bool printf_interprate_length_acceptable_inline(printf_specifier_type specifier_type,
+                                                              printf_interprate_length_type length_type) {
+    if(length_type == printf_interprate_length_none) return true;
+    switch (specifier_type) {
+        case printf_specifier_d_or_i:
+        case printf_specifier_u:
+        case printf_specifier_o:
+        case printf_specifier_x:
+        case printf_specifier_X:
+        case printf_specifier_n:
+            return length_type != printf_interprate_length_L && length_type != printf_interprate_length_Q;
+        case printf_specifier_f:
+        case printf_specifier_F:
+        case printf_specifier_e:
+        case printf_specifier_E:
+        case printf_specifier_g:
+        case printf_specifier_G:
+        case printf_specifier_a:
+        case printf_specifier_A:
+#ifdef PRINTF_FLOATING_POINT_128
+            if(length_type == printf_interprate_length_Q) return true;
 #endif
-// [NOTE] [optimization] limited precison support
-                        precision *= 10;
-                        precision += temp[0] - CHARACTER_0;
-                        
-                        temp++; // don't miss it
-                    }
-                    ELSE_DEVELOP_BREAKPOINT_RETURN(false);
-                    // [BREAKPOINT] unexpected character
-                interprate->precision_type = printf_interprate_adjustment_fix_number;
-                interprate->precision = precision;
-                current = dot_position - 1;
-                break;  // exit precison parsing
-            }
-        // break exit point [for]
-        parsingPoint[0] = current;  // updated parsingPoint
-        return true;
-    } DEBUG_ELSE
-    return false;
+            return length_type == printf_interprate_length_L || length_type == printf_interprate_length_l ||
+                   length_type == printf_interprate_length_h;
+        case printf_specifier_c:
+        case printf_specifier_s:
+            return length_type == printf_interprate_length_l;
+        default:
+            return false;
+    }
 }
 
 /*!
-    @function printf_interprate_width_parsing
-    @abstract parsing interprate width field
-    @discussion only affect [width] field
-                if no width field found return true and not affect anything
-    @param interprate if parsing success, it is used to store result
-    @param format point to the escape character (%)
-    @param parsingPoint point to the precision parsing point, if return true, this is updated to the next parsing point
-    @return true if parsing success, even no width field; false if encounter some illegal character
+    @function printf_interprate_accumulate_digit_inline
+    @abstract value = value * 10 + digit, wrap around on overflow
 */
-static bool printf_interprate_width_parsing(printf_interprate_ref _Nonnull interprate,
-                                            const UTF8Char * _Nonnull format,
-                                            const UTF8Char * _Nonnull * _Nonnull parsingPoint) {
-    if(interprate != NULL && format != NULL && parsingPoint != NULL && parsingPoint[0] != NULL && format <= parsingPoint[0]) {
-        const UTF8Char * _Nonnull current = parsingPoint[0];
-        if(current > format && current[0] == CHARACTER_asterisk) {
-            interprate->width_type = printf_interprate_adjustment_waiting_input;
-            parsingPoint[0] = current - 1;     // may at most-left to [format]
-            return true;
-        }
-        if(current > format && current[0] >= CHARACTER_0 && current[0] <= CHARACTER_9) {    // enter width parsing exist
-            // unless all zero, or there will be a width
-            const UTF8Char *leftMostNumber = current;
-            while(leftMostNumber - 1 > format && leftMostNumber[-1] >= CHARACTER_0 && leftMostNumber[-1] <= CHARACTER_9)
-                leftMostNumber--;
-            
-            bool should_parsing_width = true;       // flag for all zero test
-            
-            if(leftMostNumber[0] == CHARACTER_0) {      // enter flag zero parsing
-                const UTF8Char *leftMostZero = leftMostNumber;      DEBUG_ASSERT(leftMostZero > format);
-                while(leftMostZero + 1 <= current && leftMostZero[1] == CHARACTER_0)
-                    leftMostZero++;
-                if(leftMostZero == current) should_parsing_width = false;
-                else leftMostNumber = leftMostZero + 1;
-            }
-            
-            // if no need for parsing width, it must be all zero sequence which left for flag parsing
-            
-            if(should_parsing_width) {
-                // when enter width parsing
-                // there is need to set next current point for flag parsing
-                DEBUG_ASSERT(leftMostNumber <= current);
-                size_t width = 0;
-                
-                const UTF8Char *moveFromLeft = leftMostNumber;
-                
-                while(moveFromLeft <= current) {
-                    DEBUG_ASSERT(moveFromLeft[0] >= CHARACTER_0 && moveFromLeft[0] <= CHARACTER_9);
+static inline void printf_interprate_accumulate_digit_inline(size_t * _Nonnull value, const UTF8Char byte) {
 #ifdef DEBUG
-                    // overflow test for width field
-                    size_t overflow_test;
-                    if(__builtin_mul_overflow(width, 10, &overflow_test)) DEBUG_POINT;
-                    if(__builtin_add_overflow(width, moveFromLeft[0] - CHARACTER_0, &overflow_test)) DEBUG_POINT;
+    // overflow test for width and precision field
+    size_t overflow_test;
+    if(__builtin_mul_overflow(value[0], 10, &overflow_test)) DEBUG_POINT;
+    if(__builtin_add_overflow(overflow_test, byte - CHARACTER_0, &overflow_test)) DEBUG_POINT;
 #endif
-// [NOTE] [optimization] limited width support
-                    width *= 10;
-                    width += moveFromLeft[0] - CHARACTER_0;
-                    moveFromLeft++;
-                }
-                
-                interprate->width_type = printf_interprate_adjustment_fix_number;
-                interprate->width = width;
-                
-                current = leftMostNumber - 1; // current set to the next parsing point
-            }
-            parsingPoint[0] = current;  // updated parsingPoint
-            return true;
-        }
-        return true;        // no width for parsing
-    } DEBUG_ELSE
-    return false;
+// [NOTE] [optimization] limited width and precison support
+    value[0] = value[0] * 10 + (byte - CHARACTER_0);
 }
 
 /*!
-    @function printf_interprate_flag_parsing
-    @abstract parsing interprate flag field
-    @discussion only affect [flag] field
-                if no flag field found return true and not affect anything
-    @param interprate if parsing success, it is used to store result
-    @param format point to the escape character (%)
-    @param parsingPoint point to the precision parsing point, if return true, this is updated to the next parsing point
-    @return true if parsing success, even no flag field; false if encounter some illegal character
+    @function printf_interprate_parse_format
+    @param parsingPoint point to the escape character, updated to the next parsing point if return true
+    @param interprate used to store the interprate value
+    @abstract parsing an interprate structure used later
+    @discussion single forward pass, every byte is classified once by printf_interprate_class_table
+                leading zeros before width are flags, and flags are toggled when repeated
 */
-static bool printf_interprate_flag_parsing(printf_interprate_ref _Nonnull interprate,
-                                           const UTF8Char * _Nonnull format,
-                                           const UTF8Char * _Nonnull * _Nonnull parsingPoint) {
-    if(interprate != NULL && format != NULL && parsingPoint != NULL && parsingPoint[0] != NULL && format <= parsingPoint[0]) {
-        const UTF8Char * _Nonnull current = parsingPoint[0];
-        printf_interprate_flag flag = printf_interprate_flag_none;
-        while(current > format) {
-            // legal flags are - + (space) # 0
-            if(current[0] == CHARACTER_minus) flag ^= printf_interprate_flag_left_justify;
-            else if(current[0] == CHARACTER_plus) flag ^= printf_interprate_flag_force_sign;
-            else if(current[0] == CHARACTER_space) flag ^= printf_interprate_flag_sign_space;
-            else if(current[0] == CHARACTER_hash) flag ^= printf_interprate_flag_complex;
-            else if(current[0] == CHARACTER_0) flag ^= printf_interprate_flag_zero_padding;
-            ELSE_DEVELOP_BREAKPOINT_RETURN(false);
-            // [BREAKPOINT] unexpected character
-            current--;
-        }
-        interprate->flag = flag;
-        parsingPoint[0] = current;  // updated parsingPoint
-        return true;
+static bool printf_interprate_parse_format(const UTF8Char * _Nonnull * _Nonnull parsingPoint, printf_interprate_ref _Nonnull interprate) {
+    // [0 - 1] check input valid
+    if(parsingPoint != NULL && interprate != NULL) {
+        const UTF8Char *format = parsingPoint[0];
+        
+        // [0 - 2] check input valid
+        if(format != NULL && format[0] == CHARACTER_percentage) {
+            printf_interprate_state state = printf_interprate_state_flag;
+            printf_interprate_flag flag = printf_interprate_flag_none;
+            printf_interprate_adjustment_type width_type = printf_interprate_adjustment_unspecified;
+            printf_interprate_adjustment_type precision_type = printf_interprate_adjustment_unspecified;
+            printf_interprate_length_type length_type = printf_interprate_length_none;
+            size_t width = 0, precision = 0;
+            const UTF8Char *current = format + 1;
+            
+            // [1] scan [flag][width][.precision][length] up to the specifier
+            LOOP {
+                const UTF8Char byte = current[0];
+                switch ((printf_interprate_class)printf_interprate_class_table[byte]) {
+                    case printf_interprate_class_flag:
+                        if(state != printf_interprate_state_flag) DEVELOP_BREAKPOINT_RETURN(false);
+                        switch (byte) {
+                            case CHARACTER_minus: flag ^= printf_interprate_flag_left_justify; break;
+                            case CHARACTER_plus: flag ^= printf_interprate_flag_force_sign; break;
+                            case CHARACTER_space: flag ^= printf_interprate_flag_sign_space; break;
+                            default: flag ^= printf_interprate_flag_complex; break;
+                        }
+                        break;
+                        
+                    case printf_interprate_class_zero:
+                        if(state == printf_interprate_state_flag) {
+                            flag ^= printf_interprate_flag_zero_padding;
+                            break;
+                        }
+                        // zero is a digit elsewhere
+                        __attribute__((fallthrough));
+                    case printf_interprate_class_digit:
+                        if(state == printf_interprate_state_flag || state == printf_interprate_state_width) {
+                            state = printf_interprate_state_width;
+                            width_type = printf_interprate_adjustment_fix_number;
+                            printf_interprate_accumulate_digit_inline(&width, byte);
+                        }
+                        else if(state == printf_interprate_state_dot || state == printf_interprate_state_precision) {
+                            state = printf_interprate_state_precision;
+                            printf_interprate_accumulate_digit_inline(&precision, byte);
+                        }
+                        ELSE_DEVELOP_BREAKPOINT_RETURN(false);
+                        break;
+                        
+                    case printf_interprate_class_dot:
+                        if(state > printf_interprate_state_width_done) DEVELOP_BREAKPOINT_RETURN(false);
+                        state = printf_interprate_state_dot;
+                        precision_type = printf_interprate_adjustment_fix_number;
+                        break;
+                        
+                    case printf_interprate_class_asterisk:
+                        if(state == printf_interprate_state_flag) {
+                            state = printf_interprate_state_width_done;
+                            width_type = printf_interprate_adjustment_waiting_input;
+                        }
+                        else if(state == printf_interprate_state_dot) {
+                            state = printf_interprate_state_precision_done;
+                            precision_type = printf_interprate_adjustment_waiting_input;
+                        }
+                        ELSE_DEVELOP_BREAKPOINT_RETURN(false);
+                        break;
+                        
+                    case printf_interprate_class_length:
+                        length_type = printf_interprate_length_byte_inline(byte, length_type);
+                        if(length_type == printf_interprate_length_none) DEVELOP_BREAKPOINT_RETURN(false);
+                        state = printf_interprate_state_length;
+                        break;
+                        
+                    case printf_interprate_class_specifier: {
+                        // [2] intialize interprate object according to specifier and apply fields
+                        printf_specifier_type specifier_type = printf_interprate_check_specifier_byte_inline(byte);
+                        if(!printf_interprate_length_acceptable_inline(specifier_type, length_type))
+                            DEVELOP_BREAKPOINT_RETURN(false);
+                        if(!printf_interprate_initialize(interprate, specifier_type)) return false;
+                        interprate->flag = flag;
+                        interprate->width_type = width_type;
+                        interprate->width = width;
+                        interprate->precision_type = precision_type;
+                        if(precision_type == printf_interprate_adjustment_fix_number)
+                            interprate->precision = precision;
+                        interprate->length_type = length_type;
+                        
+// [NOTE] [optimization] validate, breakpoint at debug, fixed at runtime
+                        
+                        if(!printf_interprate_fixup_inline(interprate)) DEBUG_RETURN(false);
+                        interprate->start = format;
+                        interprate->end = current;
+                        parsingPoint[0] = current + 1;
+                        return true;
+                    }
+                        
+                    case printf_interprate_class_invalid: default:
+                        // [BREAKPOINT] unexpected character or no specifier before null-character
+                        DEVELOP_BREAKPOINT_RETURN(false);
+                }
+                current++;
+            }
+        } DEBUG_ELSE
     } DEBUG_ELSE
     return false;
 }
@@ -1314,47 +1549,8 @@ static bool printf_interprate_flag_parsing(printf_interprate_ref _Nonnull interp
     @abstract parsing an interprate structure used later
 */
 static bool printf_interprate_parser(printf_core_ref _Nonnull core, printf_interprate_ref _Nonnull interprate) {
-    // [0 - 1] check input valid
     if(core != NULL && interprate != NULL && printf_core_validate(core)) {
-        const UTF8Char *format = core->format;
-        
-        // [0 - 2] check input valid
-        if(format != NULL && format[0] == CHARACTER_percentage) {
-            const UTF8Char *specifier; printf_specifier_type specifier_type;
-            // [1] find the specifier and its type
-            if((specifier = printf_interprate_search_specifier_inline(format, &specifier_type)) != NULL) {
-                DEBUG_ASSERT(specifier > format && specifier_type != printf_specifier_invalid);
-                const UTF8Char *current = specifier;
-                
-                // [2] intialize interprate object according to specifier_type
-                if(!printf_interprate_initialize(interprate, specifier_type)) return false;
-                DEBUG_ASSERT(current >= format); if(format == current) goto JUMP_QUICK_COMPLETE;
-                
-                // [3] length parsing
-                if(!printf_interprate_length_parsing(interprate, format, &current)) return false;
-                DEBUG_ASSERT(current >= format); if(format == current) goto JUMP_QUICK_COMPLETE;
-                
-                // [4] precision parsing
-                if(!printf_interprate_precision_parsing(interprate, format, &current)) return false;
-                DEBUG_ASSERT(current >= format); if(format == current) goto JUMP_QUICK_COMPLETE;
-                
-                // [5] width parsing
-                if(!printf_interprate_width_parsing(interprate, format, &current)) return false;
-                DEBUG_ASSERT(current >= format); if(format == current) goto JUMP_QUICK_COMPLETE;
-                
-                // [6] flag parsing
-                if(!printf_interprate_flag_parsing(interprate, format, &current)) return false;
-                
-// [NOTE] [optimization] validate, breakpoint at debug, fixed at runtime
-                
-                JUMP_QUICK_COMPLETE:
-                if(!printf_interprate_fixup_inline(interprate)) DEBUG_RETURN(false);
-                interprate->start = format;
-                interprate->end = specifier;
-                core->format = specifier + 1;
-                return true;
-            } DEBUG_ELSE
-        } DEBUG_ELSE
+        return printf_interprate_parse_format(&core->format, interprate);
     } DEBUG_ELSE
     return false;
 }
@@ -1362,27 +1558,134 @@ static bool printf_interprate_parser(printf_core_ref _Nonnull core, printf_inter
 #pragma mark - supporting
 
 /*!
-    @function printf_strchr_inline
-    @abstract just a strchr with default implementation
+    @function printf_literal_span_scalar
+    @abstract byte-at-a-time fallback of printf_literal_span_length_inline
 */
-static inline const UTF8Char * _Nullable printf_strchr_inline(const UTF8Char * _Nonnull str, const UTF8Char ch) {
-    if(str != NULL) {
-        LOOP {
-            if(str[0] == ch) return str;
-            if(str[0] == CHARACTER_null) return NULL;
-            str++;
-        }
-    } DEBUG_ELSE
-    return NULL;
+static size_t printf_literal_span_scalar(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii) {
+    size_t index = 0;
+    UTF8Char seen = 0;
+    while(str[index] != CHARACTER_percentage && str[index] != CHARACTER_null) seen |= str[index++];
+    non_ascii[0] = !UTF8Mask0(seen);
+    return index;
 }
 
+#if defined PRINTF_LITERAL_SPAN_X86
+
 /*!
-    @function printf_strlen_inline
-    @abstract just a strlen with default implementation
+    @function printf_literal_span_sse2
+    @abstract search 16 bytes at a time
+    @discussion only aligned blocks are loaded, bytes after the null-character may be read
+                but never across a page boundary, the sign bits of the same load tell non-ASCII bytes
 */
-static inline size_t printf_strlen_inline(const UTF8Char * _Nonnull str) {
-    if(str == NULL) DEBUG_RETURN(0);
-    size_t index;
+PRINTF_NO_SANITIZE_ADDRESS
+static size_t printf_literal_span_sse2(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii) {
+    const __m128i percentage = _mm_set1_epi8(CHARACTER_percentage);
+    const __m128i null = _mm_setzero_si128();
+    size_t misalign = (uintptr_t)str & 15;
+    const __m128i *block = (const __m128i *)(str - misalign);
+    __m128i data = _mm_load_si128(block);
+    unsigned int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, percentage), _mm_cmpeq_epi8(data, null)));
+    unsigned int high = _mm_movemask_epi8(data) >> misalign;
+    mask >>= misalign;
+    if(mask != 0) {
+        size_t length = __builtin_ctz(mask);
+        non_ascii[0] = (high & ((1u << length) - 1)) != 0;
+        return length;
+    }
+    unsigned int seen = high;
+    size_t length = 16 - misalign;
+    LOOP {
+        data = _mm_load_si128(++block);
+        mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, percentage), _mm_cmpeq_epi8(data, null)));
+        high = _mm_movemask_epi8(data);
+        if(mask != 0) {
+            size_t tail = __builtin_ctz(mask);
+            seen |= high & ((1u << tail) - 1);
+            non_ascii[0] = seen != 0;
+            return length + tail;
+        }
+        seen |= high;
+        length += 16;
+    }
+}
+
+/*!
+    @function printf_literal_span_avx2
+    @abstract search 32 bytes at a time, same as printf_literal_span_sse2
+*/
+PRINTF_NO_SANITIZE_ADDRESS __attribute__((target("avx2")))
+static size_t printf_literal_span_avx2(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii) {
+    const __m256i percentage = _mm256_set1_epi8(CHARACTER_percentage);
+    const __m256i null = _mm256_setzero_si256();
+    size_t misalign = (uintptr_t)str & 31;
+    const __m256i *block = (const __m256i *)(str - misalign);
+    __m256i data = _mm256_load_si256(block);
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(data, percentage), _mm256_cmpeq_epi8(data, null)));
+    uint32_t high = (uint32_t)_mm256_movemask_epi8(data) >> misalign;
+    mask >>= misalign;
+    if(mask != 0) {
+        size_t length = __builtin_ctz(mask);
+        non_ascii[0] = (high & ((UINT32_C(1) << length) - 1)) != 0;
+        return length;
+    }
+    uint32_t seen = high;
+    size_t length = 32 - misalign;
+    LOOP {
+        data = _mm256_load_si256(++block);
+        mask = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(data, percentage), _mm256_cmpeq_epi8(data, null)));
+        high = (uint32_t)_mm256_movemask_epi8(data);
+        if(mask != 0) {
+            size_t tail = __builtin_ctz(mask);
+            seen |= high & ((UINT32_C(1) << tail) - 1);
+            non_ascii[0] = seen != 0;
+            return length + tail;
+        }
+        seen |= high;
+        length += 32;
+    }
+}
+
+#endif
+
+typedef size_t (* printf_literal_span_func_t)(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii);
+
+static size_t printf_literal_span_dispatch(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii);
+
+static printf_literal_span_func_t printf_literal_span_kernel = printf_literal_span_dispatch;
+
+/*!
+    @function printf_literal_span_dispatch
+    @abstract choose the kernel by cpu feature on first use
+*/
+static size_t printf_literal_span_dispatch(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii) {
+    printf_literal_span_func_t kernel = printf_literal_span_scalar;
+#if defined PRINTF_LITERAL_SPAN_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) kernel = printf_literal_span_avx2;
+    else kernel = printf_literal_span_sse2;
+#endif
+    __atomic_store_n(&printf_literal_span_kernel, kernel, __ATOMIC_RELAXED);
+    return kernel(str, non_ascii);
+}
+
+/*!
+    @function printf_literal_span_length_inline
+    @param non_ascii set to true if any byte of the span has the high bit,
+           only such span needs printf_UTF8Span_validate
+    @return byte amount before the next escape character or the null-character
+*/
+static inline size_t printf_literal_span_length_inline(const UTF8Char * _Nonnull str, bool * _Nonnull non_ascii) {
+    if(str == NULL || non_ascii == NULL) DEBUG_RETURN(0);
+    return __atomic_load_n(&printf_literal_span_kernel, __ATOMIC_RELAXED)(str, non_ascii);
+}
+
+/*!
+    @function printf_strlen_inline
+    @abstract just a strlen with default implementation
+*/
+static inline size_t printf_strlen_inline(const UTF8Char * _Nonnull str) {
+    if(str == NULL) DEBUG_RETURN(0);
+    size_t index;
     for(index = 0; str[index] != CHARACTER_null; index++) continue;
     return index;
 }
@@ -1399,57 +1702,81 @@ static inline size_t printf_strlen_minimum_inline(const UTF8Char * _Nonnull str,
 }
 
 /*!
-    @function printf_core_output_raw_string
-    @abstract when str == NULL or length == zero, nothing is ouputed
-    @discussion this will not update core->format location info
-    @param length  length and strlen the minimun decide which to ouput, also need enough storage
+    @function printf_core_output_raw_bytes
+    @abstract output exactly length bytes of str, no null-character scanning performed
 */
-static void printf_core_output_raw_string(printf_core_ref _Nonnull core, const UTF8Char * _Nullable str, size_t length) {
-    if(core != NULL) {
-        if(str != NULL && length > 0) {
-            size_t actual_string_length = printf_strlen_minimum_inline(str, length);
+static void printf_core_output_raw_bytes(printf_core_ref _Nonnull core, const UTF8Char * _Nonnull str, size_t length) {
+    if(core != NULL && str != NULL) {
+        if(length > 0) {
             if(core->type == printf_type_FILE) {
-                if(core->output.file != NULL) {
-                    fwrite(str, actual_string_length * sizeof(UTF8Char), 1, core->output.file);
-                } DEBUG_ELSE
+                printf_core_file_write(core, str, length);
             }
             else if(core->type == printf_type_string) {
-                if(core->output.string.store != NULL && core->output.string.index + 1 < core->output.string.count) {
-                    DEBUG_ASSERT(core->output.string.store[core->output.string.index] == CHARACTER_null);
-                    size_t max_store_amount = core->output.string.count - core->output.string.index - 1;
-                    size_t store_amount = max_store_amount;
-                    if(actual_string_length < store_amount) store_amount = actual_string_length;
-                    
-                    for(size_t increase = 0; increase < store_amount; increase++)
-                        core->output.string.store[core->output.string.index + increase] = str[increase];
-                    
-                    core->output.string.store[core->output.string.index + store_amount] = CHARACTER_null;
+                size_t store_amount = core->output.string.remain;
+                if(length < store_amount) store_amount = length;
+                if(store_amount > 0) {
+                    __builtin_memcpy(core->output.string.store + core->output.string.index, str, store_amount);
                     core->output.string.index += store_amount;
+                    core->output.string.remain -= store_amount;
                 }
             } DEBUG_ELSE
-            core->actual_need += actual_string_length;
+            core->actual_need += length;
         }
     } DEBUG_ELSE
 }
 
+/*!
+    @function printf_core_output_raw_string
+    @abstract when str == NULL or length == zero, nothing is ouputed
+    @discussion this will not update core->format location info
+    @param length  length and strlen the minimun decide which to ouput, also need enough storage
+*/
+static void printf_core_output_raw_string(printf_core_ref _Nonnull core, const UTF8Char * _Nullable str, size_t length) {
+    if(core != NULL) {
+        if(str != NULL && length > 0)
+            printf_core_output_raw_bytes(core, str, printf_strlen_minimum_inline(str, length));
+    } DEBUG_ELSE
+}
+
 static void printf_core_output_character(printf_core_ref _Nonnull core, UTF8Char character) {
     if(core != NULL) {
         if(core->type == printf_type_FILE) {
-            if(core->output.file != NULL) {
-                fputc(character, core->output.file);
-            } DEBUG_ELSE
+            printf_core_file_put_inline(core, character);
         }
         else if(core->type == printf_type_string) {
-            if(core->output.string.store != NULL && core->output.string.index + 1 < core->output.string.count) {
-                DEBUG_ASSERT(core->output.string.store[core->output.string.index] == CHARACTER_null);
+            if(core->output.string.remain > 0) {
                 core->output.string.store[core->output.string.index++] = character;
-                core->output.string.store[core->output.string.index] = CHARACTER_null;
+                core->output.string.remain--;
             }
         } DEBUG_ELSE
         core->actual_need += 1;
     } DEBUG_ELSE
 }
 
+/*!
+    @function printf_core_output_fill
+    @abstract output count copies of byte, used for width and precision padding
+    @discussion store or stage the whole run at once instead of one call per byte
+*/
+static void printf_core_output_fill(printf_core_ref _Nonnull core, UTF8Char byte, size_t count) {
+    if(core != NULL) {
+        if(count > 0) {
+            if(core->type == printf_type_FILE) {
+                printf_core_file_fill(core, byte, count);
+            }
+            else if(core->type == printf_type_string) {
+                size_t store_amount = count < core->output.string.remain ? count : core->output.string.remain;
+                if(store_amount > 0) {
+                    __builtin_memset(core->output.string.store + core->output.string.index, byte, store_amount);
+                    core->output.string.index += store_amount;
+                    core->output.string.remain -= store_amount;
+                }
+            } DEBUG_ELSE
+            core->actual_need += count;
+        }
+    } DEBUG_ELSE
+}
+
 #pragma mark - flag / width helper
 
 typedef enum printf_sign {
@@ -1561,8 +1888,7 @@ static bool printf_core_output_flag_width_help(printf_core_ref _Nonnull core,
                         case printf_complex_prefix_none: default:
                             DEBUG_RETURN(false);
                     }
-                for(size_t index = 0; index < insert_amount; index++)
-                    printf_core_output_character(core, CHARACTER_0);
+                printf_core_output_fill(core, CHARACTER_0, insert_amount);
                 if(!pure_function(core, interprate, pure_width, input)) DEBUG_RETURN(false);
             }
             else if(interprate->flag & printf_interprate_flag_left_justify) {
@@ -1586,12 +1912,10 @@ static bool printf_core_output_flag_width_help(printf_core_ref _Nonnull core,
                             DEBUG_RETURN(false);
                     }
                 if(!pure_function(core, interprate, pure_width, input)) DEBUG_RETURN(false);
-                for(size_t index = 0; index < insert_amount; index++)
-                    printf_core_output_character(core, CHARACTER_space);
+                printf_core_output_fill(core, CHARACTER_space, insert_amount);
             }
             else {
-                for(size_t index = 0; index < insert_amount; index++)
-                    printf_core_output_character(core, CHARACTER_space);
+                printf_core_output_fill(core, CHARACTER_space, insert_amount);
                 if(sign == printf_sign_minus) printf_core_output_character(core, CHARACTER_minus);
                 else if(sign == printf_sign_plus) printf_core_output_character(core, CHARACTER_plus);
                 else if(sign == printf_sign_space) printf_core_output_character(core, CHARACTER_space);
@@ -1623,15 +1947,24 @@ static bool printf_core_output_flag_width_help(printf_core_ref _Nonnull core,
 
 // this assume IEEE 754 standard Binary interchange format (binary 32/binary 64)
 // [Documentation] IEEE Std 754 - 2008 (page 13)
+// and x87 extended precision format (80 bit) for long double where it is one
 
-// float                (binary 32)
-// double & long double (binary 64)
+// float                (binary 32) [h] length
+// double               (binary 64)
+// long double          (80 bit, binary 64 otherwise)
+// __float128           (binary 128) [Q] length
 
 #pragma mark supported binary exchange format
 
 typedef enum IEEE754_type {
     IEEE754_type_32,
-    IEEE754_type_64
+    IEEE754_type_64,
+#ifdef PRINTF_FLOATING_POINT_80
+    IEEE754_type_80,
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+    IEEE754_type_128,
+#endif
 } IEEE754_type;
 
 typedef enum fp_classification {
@@ -1655,6 +1988,10 @@ static void __HIDDEN__check_floating_point_alignment(void) {  // DO NOT DELETE
     COMILE_ASSERT(FLT_MANT_DIG == 24);
     COMILE_ASSERT(DBL_MANT_DIG == 53);
 //    COMILE_ASSERT(LDBL_MANT_DIG == 53);
+#ifdef PRINTF_FLOATING_POINT_80
+    COMILE_ASSERT(sizeof(long double) >= 10);
+    COMILE_ASSERT(LDBL_MANT_DIG == 64);
+#endif
     
     // binary exchange format
     COMILE_ASSERT(FLT_RADIX == 2);
@@ -1676,16 +2013,54 @@ CLANG_DIAGNOSTIC_POP
 #define FP64_SIGNIFICAND_0_BIT  32
 #define FP64_SIGNIFICAND_1_BIT  20
 
+// integer bit is explicit, not counted in significand bit
+#define FP80_SIGN_BIT           1
+#define FP80_EXPONENT_BIT       15
+#define FP80_SIGNIFICAND_BIT    63
+
+#define FP128_SIGN_BIT          1
+#define FP128_EXPONENT_BIT      15
+#define FP128_SIGNIFICAND_BIT   112
+
+// this split significand into two uint64_t bit field
+#define FP128_SIGNIFICAND_0_BIT 64
+#define FP128_SIGNIFICAND_1_BIT 48
+
+// shortest digits amount to read back any binary 64
+#define FP64_SHORTEST_DIGITS_MAX    17
+
+// fixed precision digits are kept in unsigned __int128, up to the digits amount to read back the format
+#define FP64_FIXED_PRECISION_MAX    17
+#define FP80_FIXED_PRECISION_MAX    21
+#define FP128_FIXED_PRECISION_MAX   36
+// 10^(38) is the last power of ten below 2^(128)
+#define FP64_FIXED_DIGITS_MAX       38
+
+// all digits of a binary 32, (2^(24) - 1) x 5^(149) has 112 digits
+#define FP32_EXACT_DIGITS_MAX       112
+// 10 x fraction below 2^(149) and 2^(128) integer fit 5 x 32 bit
+#define FP32_EXACT_LIMB_AMOUNT      5
+
 #pragma mark range macro
 
 #define FP32_EXPONENT_RAW_MAX   0xFF
 #define FP64_EXPONENT_RAW_MAX   0x7FF
+#define FP80_EXPONENT_RAW_MAX   0x7FFF
+#define FP128_EXPONENT_RAW_MAX  0x7FFF
 
 #define FP32_EXPONENT_BASE      0x7F
 #define FP64_EXPONENT_BASE      0x3FF
+#define FP80_EXPONENT_BASE      0x3FFF
+#define FP128_EXPONENT_BASE     0x3FFF
 
 // max exponent bit for all supported floating point type
+#if   defined PRINTF_FLOATING_POINT_80
+#define FP_EXPONENT_BIT_MAX     FP80_EXPONENT_BIT
+#elif defined PRINTF_FLOATING_POINT_128
+#define FP_EXPONENT_BIT_MAX     FP128_EXPONENT_BIT
+#else
 #define FP_EXPONENT_BIT_MAX     FP64_EXPONENT_BIT
+#endif
 
 #pragma mark nan string array
 
@@ -1709,12 +2084,24 @@ static UTF8Char __IEE_754_inf_string_lowercase__[] = {CHARACTER_i, CHARACTER_n,
 
 typedef float  fp32_t;      // 32 bit
 typedef double fp64_t;      // 64 bit
+#ifdef PRINTF_FLOATING_POINT_80
+typedef long double fp80_t; // 80 bit
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+typedef __float128 fp128_t; // 128 bit
+#endif
 
 typedef struct fp_info {
     IEEE754_type type;
     union {
         fp32_t fp32;
         fp64_t fp64;
+#ifdef PRINTF_FLOATING_POINT_80
+        fp80_t fp80;
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+        fp128_t fp128;
+#endif
     } value;
 } fp_info;
 
@@ -1739,6 +2126,45 @@ typedef union fp64_info {
     } component GNU_ATTRIBUTE_PACKED;
 } fp64_info;
 
+#pragma mark floating point 80 bit component
+
+#ifdef PRINTF_FLOATING_POINT_80
+
+// x87 is little endian only
+typedef union fp80_info {
+    fp80_t value;
+    struct {
+        uint64_t significand;               // integer bit is the highest
+        unsigned int exponent:       FP80_EXPONENT_BIT;
+        unsigned int sign:           FP80_SIGN_BIT;
+    } component GNU_ATTRIBUTE_PACKED;
+} fp80_info;
+
+#endif
+
+#pragma mark floating point binary 128 component
+
+#ifdef PRINTF_FLOATING_POINT_128
+
+typedef union fp128_info {
+    fp128_t value;
+    struct {
+#if   defined PRINTF_LITTLE_ENDIAN
+        uint64_t significand_0 :     FP128_SIGNIFICAND_0_BIT;
+        uint64_t significand_1 :     FP128_SIGNIFICAND_1_BIT;
+        uint64_t exponent:           FP128_EXPONENT_BIT;
+        uint64_t sign:               FP128_SIGN_BIT;
+#elif defined PRINTF_BIG_ENDIAN
+        uint64_t sign:               FP128_SIGN_BIT;
+        uint64_t exponent:           FP128_EXPONENT_BIT;
+        uint64_t significand_1 :     FP128_SIGNIFICAND_1_BIT;
+        uint64_t significand_0 :     FP128_SIGNIFICAND_0_BIT;
+#endif
+    } component GNU_ATTRIBUTE_PACKED;
+} fp128_info;
+
+#endif
+
 #pragma mark floating point binary 32 component
 
 typedef union fp32_info {
@@ -1764,9 +2190,18 @@ typedef union fp32_info {
  */
 static inline bool floating_point_info_validate_inline(fp_info_ref _Nonnull info) {
     if(info != NULL) {
-        if(info->type == IEEE754_type_32 || info->type == IEEE754_type_64) {
-            return true;
-        } DEBUG_ELSE
+        switch (info->type) {
+            case IEEE754_type_32:
+            case IEEE754_type_64:
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80:
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128:
+#endif
+                return true;
+            default: DEBUG_POINT break;
+        }
     } DEBUG_ELSE
     return false;
 }
@@ -1802,6 +2237,42 @@ static inline bool floating_point_intialize_64bit_inline(fp_info_ref _Nonnull in
     return false;
 }
 
+#ifdef PRINTF_FLOATING_POINT_80
+
+/*!
+    @function floating_point_intialize_80bit_inline
+    @discussion used to intialized an fp_info object for 80 bit
+    @return true if initialize complete, false if error occured
+*/
+static inline bool floating_point_intialize_80bit_inline(fp_info_ref _Nonnull info, fp80_t fp80) {
+    if(info != NULL) {
+        info->type = IEEE754_type_80;
+        info->value.fp80 = fp80;
+        return true;
+    } DEBUG_ELSE
+    return false;
+}
+
+#endif
+
+#ifdef PRINTF_FLOATING_POINT_128
+
+/*!
+    @function floating_point_intialize_128bit_inline
+    @discussion used to intialized an fp_info object for 128 bit
+    @return true if initialize complete, false if error occured
+*/
+static inline bool floating_point_intialize_128bit_inline(fp_info_ref _Nonnull info, fp128_t fp128) {
+    if(info != NULL) {
+        info->type = IEEE754_type_128;
+        info->value.fp128 = fp128;
+        return true;
+    } DEBUG_ELSE
+    return false;
+}
+
+#endif
+
 CLANG_DIAGNOSTIC_POP
 
 /*!
@@ -1816,6 +2287,17 @@ static inline bool floating_point_info_query_sign_bit_inline(fp_info_ref _Nonnul
                 return ((uint8_t *)(&info->value.fp32))[3] & 0x80;
             case IEEE754_type_64:
                 return ((uint8_t *)(&info->value.fp32))[7] & 0x80;
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80:
+                return ((uint8_t *)(&info->value.fp80))[9] & 0x80;
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128: {
+                fp128_info query;
+                query.value = info->value.fp128;
+                return query.component.sign;
+            }
+#endif
             default: DEBUG_POINT break;
         }
     } DEBUG_ELSE
@@ -1836,6 +2318,20 @@ static inline unsigned int floating_point_info_query_raw_exponent_inline(fp_info
                 query.value = info->value.fp64;
                 return query.component.exponent;
             }
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80: {
+                fp80_info query;
+                query.value = info->value.fp80;
+                return query.component.exponent;
+            }
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128: {
+                fp128_info query;
+                query.value = info->value.fp128;
+                return (unsigned int)query.component.exponent;
+            }
+#endif
             default: DEBUG_POINT break;
         }
     } DEBUG_ELSE
@@ -1851,6 +2347,14 @@ static inline unsigned int floating_point_query_exponent_base(fp_info_ref _Nonnu
             case IEEE754_type_64: {
                 return FP64_EXPONENT_BASE;
             }
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80:
+                return FP80_EXPONENT_BASE;
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128:
+                return FP128_EXPONENT_BASE;
+#endif
             default: DEBUG_POINT break;
         }
     }
@@ -1892,6 +2396,46 @@ static fp_classification floating_point_info_classification(fp_info_ref _Nonnull
                 }
                 else return fp_classification_normal;
             }
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80: {
+                unsigned int raw_exponent = floating_point_info_query_raw_exponent_inline(info);
+                DEBUG_ASSERT(raw_exponent <= FP80_EXPONENT_RAW_MAX);
+                fp80_info query;
+                query.value = info->value.fp80;
+                const uint64_t integer_bit = UINT64_C(1) << FP80_SIGNIFICAND_BIT;
+                if(raw_exponent == FP80_EXPONENT_RAW_MAX) {
+                    if(query.component.significand == integer_bit) return fp_classification_infinite;
+                    else return fp_classification_nan;      // pseudo infinity included
+                }
+                else if(raw_exponent == 0) {
+                    // pseudo denormal [integer bit set] is never produced by x87, integer bit is ignored
+                    if(query.component.significand == 0) return fp_classification_zero;
+                    else return fp_classification_subnormal;
+                }
+                else if(!(query.component.significand & integer_bit))
+                    return fp_classification_nan;           // unnormal is an invalid operand
+                else return fp_classification_normal;
+            }
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128: {
+                unsigned int raw_exponent = floating_point_info_query_raw_exponent_inline(info);
+                DEBUG_ASSERT(raw_exponent <= FP128_EXPONENT_RAW_MAX);
+                fp128_info query;
+                query.value = info->value.fp128;
+                if(raw_exponent == FP128_EXPONENT_RAW_MAX) {
+                    if(query.component.significand_0 == 0 && query.component.significand_1 == 0) return fp_classification_infinite;
+                    else return fp_classification_nan;
+                }
+                else if(raw_exponent == 0) {
+                    if(query.component.significand_0 == 0 &&
+                       query.component.significand_1 == 0)
+                        return fp_classification_zero;
+                    else return fp_classification_subnormal;
+                }
+                else return fp_classification_normal;
+            }
+#endif
             default: DEBUG_POINT break;
         }
     } DEBUG_ELSE
@@ -1899,48 +2443,108 @@ static fp_classification floating_point_info_classification(fp_info_ref _Nonnull
 }
 
 /*!
-    @function floating_point_info_query_significand_bit
-    @param significand used to store significand bit not count for
-           implicit 1 for normal form and nor the 0 for abnormal form
-           if not null, at most "size" amount of data is stored
-    @param size maximun size for significand
-    @return actual needed "size" amount, index 0 point to the highest bit [ 2^(-1) mostly ]
-    @discussion if significand is not null, min [ returned, size ] data is stored
+    @function floating_point_info_query_significand_bit_amount_inline
+    @return explicit significand bit amount, not count for implicit 1 for normal form
  */
-static size_t floating_point_info_query_significand_bit(fp_info_ref _Nonnull info, bool * _Nullable significand, size_t size) {
+static inline size_t floating_point_info_query_significand_bit_amount_inline(fp_info_ref _Nonnull info) {
     if(info != NULL && floating_point_info_validate_inline(info)) {
         switch (info->type) {
-            case IEEE754_type_32: {
-                if(significand != NULL) {
-                    fp32_info query;
-                    query.value = info->value.fp32;
-                    size_t count = FP32_SIGNIFICAND_BIT;
-                    if(size < count) count = size;
-                    for(size_t index = 0; index < count; index++)
-                        significand[index] = query.component.significand & (1 << (FP32_SIGNIFICAND_BIT - 1 - index));
-                }
-                return FP32_SIGNIFICAND_BIT;
-            }
+            case IEEE754_type_32: return FP32_SIGNIFICAND_BIT;
+            case IEEE754_type_64: return FP64_SIGNIFICAND_BIT;
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80: return FP80_SIGNIFICAND_BIT;
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128: return FP128_SIGNIFICAND_BIT;
+#endif
+            default: DEBUG_POINT break;
+        }
+    } DEBUG_ELSE
+    return 0;
+}
+
+/*!
+    @function floating_point_info_query_significand_32_inline
+    @return explicit significand bits of binary 32 in low bits, implicit 1 not included
+ */
+static inline uint32_t floating_point_info_query_significand_32_inline(fp_info_ref _Nonnull info) {
+    if(info != NULL && floating_point_info_validate_inline(info) && info->type == IEEE754_type_32) {
+        fp32_info query;
+        query.value = info->value.fp32;
+        return query.component.significand;
+    } DEBUG_ELSE
+    return 0;
+}
+
+/*!
+    @function floating_point_info_query_significand_inline
+    @return explicit significand bits in low bits, bit [amount - 1] is the highest [ 2^(-1) mostly ]
+    @discussion implicit 1 for normal form and the 0 for abnormal form are not included,
+                neither is the explicit integer bit of 80 bit, only lowest 64 bit of binary 128
+ */
+static inline uint64_t floating_point_info_query_significand_inline(fp_info_ref _Nonnull info) {
+    COMILE_ASSERT(sizeof(uint64_t) * CHAR_BIT > FP64_SIGNIFICAND_BIT);
+    if(info != NULL && floating_point_info_validate_inline(info)) {
+        switch (info->type) {
+            case IEEE754_type_32:
+                return floating_point_info_query_significand_32_inline(info);
             case IEEE754_type_64: {
-                if(significand != NULL) {
-                    fp64_info query;
-                    query.value = info->value.fp64;
-                    size_t count = FP64_SIGNIFICAND_BIT;
-                    if(size < count) count = size;
-                    for(size_t index = 0; index < count; index++)
-                        if(index >= FP64_SIGNIFICAND_1_BIT)
-                            significand[index] = query.component.significand_0 & (1 << (FP64_SIGNIFICAND_0_BIT - 1 - (index - FP64_SIGNIFICAND_1_BIT)));
-                        else
-                            significand[index] = query.component.significand_1 & (1 << (FP64_SIGNIFICAND_1_BIT - 1 - index));
-                }
-                return FP64_SIGNIFICAND_BIT;
+                fp64_info query;
+                query.value = info->value.fp64;
+                return ((uint64_t)query.component.significand_1 << FP64_SIGNIFICAND_0_BIT) | query.component.significand_0;
+            }
+#ifdef PRINTF_FLOATING_POINT_80
+            case IEEE754_type_80: {
+                fp80_info query;
+                query.value = info->value.fp80;
+                return query.component.significand & ~(UINT64_C(1) << FP80_SIGNIFICAND_BIT);
             }
+#endif
+#ifdef PRINTF_FLOATING_POINT_128
+            case IEEE754_type_128: {
+                fp128_info query;
+                query.value = info->value.fp128;
+                return query.component.significand_0;
+            }
+#endif
             default: DEBUG_POINT break;
         }
     } DEBUG_ELSE
     return 0;
 }
 
+/*!
+    @function floating_point_info_query_significand_high_inline
+    @return explicit significand bits above the lowest 64 bit, zero if significand bit amount is within 64
+ */
+static inline uint64_t floating_point_info_query_significand_high_inline(fp_info_ref _Nonnull info) {
+#ifdef PRINTF_FLOATING_POINT_128
+    if(info != NULL && floating_point_info_validate_inline(info) && info->type == IEEE754_type_128) {
+        fp128_info query;
+        query.value = info->value.fp128;
+        return query.component.significand_1;
+    }
+#endif
+    return 0;
+}
+
+/*!
+    @function floating_point_info_set_significand_inline
+    @abstract array bits from bit_index are replaced by significand [ with the implicit 1 if needed ]
+    @discussion array should have bit amount + 1 bits from bit_index at least
+ */
+static inline void floating_point_info_set_significand_inline(fp_info_ref _Nonnull info,
+                                                              EXT_ARRAY _Nonnull array,
+                                                              size_t length,
+                                                              size_t bit_index,
+                                                              bool implicit_one) {
+    size_t significand_bit_amount = floating_point_info_query_significand_bit_amount_inline(info);
+    extended_integer_set_uint64(array, length, bit_index, floating_point_info_query_significand_inline(info));
+    if(significand_bit_amount > 64)
+        extended_integer_set_uint64(array, length, bit_index + 64, floating_point_info_query_significand_high_inline(info));
+    if(implicit_one) extended_integer_set_bit(array, length, bit_index + significand_bit_amount, true);
+}
+
 #pragma mark debug
 
 #ifdef DEBUG
@@ -1972,7 +2576,43 @@ void floating_point_info_debug(double value) {
 
 #pragma mark integer type [iduoxX]
 
-static bool printf_output_specifier_integer_iduoxX(printf_core_ref _Nonnull core, printf_interprate_ref _Nonnull interprate) {
+/*!
+    @function printf_integer_decimal_digits_amount_inline
+    @abstract digits amount estimated from the bit length, then fixed by one table compare
+    @return decimal digits amount of value, 1 for zero
+*/
+static inline unsigned int printf_integer_decimal_digits_amount_inline(uint64_t value) {
+    unsigned int bits = 64 - __builtin_clzll(value | 1);
+    unsigned int estimate = ((bits - 1) * 1233) >> 12;    // floor((bits - 1) * log10(2))
+    DEBUG_ASSERT(estimate + 1 < ARRAY_SIZE(base10_power_uint64));
+    return estimate + 1 + (value >= base10_power_uint64[estimate + 1]);
+}
+
+/*!
+    @function printf_integer_decimal_digits_fill_inline
+    @param end one past the last digit position, digits are stored backward from it
+    @return first digit position
+*/
+static inline UTF8Char * _Nonnull printf_integer_decimal_digits_fill_inline(UTF8Char * _Nonnull end, uint64_t value) {
+    while(value >= 100) {
+        size_t pair = (size_t)(value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        __builtin_memcpy(end, base10_pair_character + pair, 2);
+    }
+    if(value >= 10) {
+        end -= 2;
+        __builtin_memcpy(end, base10_pair_character + value * 2, 2);
+    }
+    else *--end = base10_character[value];
+    return end;
+}
+
+/*!
+    @function printf_output_specifier_integer_iduoxX
+    @param is_pointer [p] output as x, the 0x prefix is taken even for null
+ */
+static bool printf_output_specifier_integer_iduoxX(printf_core_ref _Nonnull core, printf_interprate_ref _Nonnull interprate, bool is_pointer) {
     if(core != NULL && interprate != NULL && printf_specifier_type_is_integer_inline(interprate->type)) {
         
         COMILE_ASSERT(sizeof(intmax_t) >= sizeof(long long));
@@ -2059,36 +2699,38 @@ static bool printf_output_specifier_integer_iduoxX(printf_core_ref _Nonnull core
         
         // consider zero as one digit ouput
         // not fixed up for precison zero
-        unsigned int digits_amount = 1;
+        unsigned int digits_amount;
+        
+        COMILE_ASSERT(sizeof(uintmax_t) == sizeof(uint64_t));
+        COMILE_ASSERT(PRINTF_INTEGER_BUFFER_SIZE >= (sizeof(uintmax_t) * 8 + 2) / 3 + 2);
+        
+        // digits are stored backward from the buffer end, leaving room for sign or prefix ahead
+        UTF8Char buffer[PRINTF_INTEGER_BUFFER_SIZE];
+        UTF8Char *digits = buffer + ARRAY_SIZE(buffer);
         
-        uintmax_t base = 10u;
         if(interprate->type == printf_specifier_d_or_i ||
-           interprate->type == printf_specifier_u)
-            base = 10u;
-        else if(interprate->type == printf_specifier_o)
-            base = 8u;
+           interprate->type == printf_specifier_u) {
+            digits_amount = printf_integer_decimal_digits_amount_inline(value);
+            digits = printf_integer_decimal_digits_fill_inline(digits, value);
+        }
+        else if(interprate->type == printf_specifier_o) {
+            digits_amount = (64 - __builtin_clzll(value | 1) + 2) / 3;
+            uintmax_t temp = value;
+            for(unsigned int count = digits_amount; count > 0; count--, temp >>= 3)
+                *--digits = base8_character[temp & 7];
+        }
         else if(interprate->type == printf_specifier_x ||
-                interprate->type == printf_specifier_X)
-            base = 16u;
+                interprate->type == printf_specifier_X) {
+            const UTF8Char *table = interprate->type == printf_specifier_x ?
+                base16_character_lowercase : base16_character_uppercase;
+            digits_amount = (64 - __builtin_clzll(value | 1) + 3) / 4;
+            uintmax_t temp = value;
+            for(unsigned int count = digits_amount; count > 0; count--, temp >>= 4)
+                *--digits = table[temp & 15];
+        }
         ELSE_DEBUG_RETURN(false);
         
-        uintmax_t temp = value;
-        while((temp = temp / base) > 0) digits_amount++;
-        
-        // not much meaningful
-        COMILE_ASSERT(sizeof(intmax_t) <= PRINTF_INTEGER_MAX_DIGITS_AMOUNT);
-        
-        // most impossible condition
-        if(digits_amount > PRINTF_INTEGER_MAX_DIGITS_AMOUNT) DEBUG_RETURN(false);
-        
-        // most impossible condition
-        if(digits_amount > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
-        
-        uint8_t * eachDigits = printf_stack_alloc(digits_amount);
-        
-        size_t index = 0; uintmax_t temp2 = value;
-        do eachDigits[index++] = temp2 % base;
-        while((temp2 = temp2 / base) > 0);
+        DEBUG_ASSERT(digits == buffer + ARRAY_SIZE(buffer) - digits_amount);
         
         // unable to parsing complex flag for integer type d or i
         DEBUG_ASSERT((interprate->type != printf_specifier_d_or_i) || !(interprate->flag & printf_interprate_flag_complex));
@@ -2137,26 +2779,28 @@ static bool printf_output_specifier_integer_iduoxX(printf_core_ref _Nonnull core
         printf_complex_prefix prefix = printf_complex_prefix_none;
         size_t prefix_length = 0;
         if(interprate->type == printf_specifier_o) {
-            if(interprate->flag & printf_interprate_flag_complex) {
+            // only when the first digit is not zero already
+            if(interprate->flag & printf_interprate_flag_complex &&
+               (zero_no_digit || (value != 0 && precision_padding_zero == 0))) {
                 prefix = printf_complex_prefix_0;
                 prefix_length = 1;
             }
         }
         else if(interprate->type == printf_specifier_x) {
-            if(interprate->flag & printf_interprate_flag_complex) {
+            if(interprate->flag & printf_interprate_flag_complex && (value != 0 || is_pointer)) {
                 prefix = printf_complex_prefix_0x;
                 prefix_length = 2;
             }
         }
         else if(interprate->type == printf_specifier_X) {
-            if(interprate->flag & printf_interprate_flag_complex) {
+            if(interprate->flag & printf_interprate_flag_complex && value != 0) {
                 prefix = printf_complex_prefix_0X;
                 prefix_length = 2;
             }
         }
         
 #ifdef PRINTF_DISBALE_FLAG_COMPLEX_FOR_INTEGER_VALUE_ZERO_WITH_PRECISION_ZERO
-        if(zero_no_digit) {
+        if(zero_no_digit && interprate->type != printf_specifier_o) {
             prefix = printf_complex_prefix_none;
             prefix_length = 0;      // not quite aligned to GNUC odd implementation
         }
@@ -2191,9 +2835,11 @@ static bool printf_output_specifier_integer_iduoxX(printf_core_ref _Nonnull core
         if(interprate->width > least_character_amount) need_consider_width = true;
         else need_consider_width = false;
         
+#ifdef DEBUG
         size_t full_output_character_amount;
         if(need_consider_width) full_output_character_amount = interprate->width;
         else full_output_character_amount = least_character_amount;
+#endif
         
         size_t width_addition_amount = 0;
         if(need_consider_width) width_addition_amount = interprate->width - least_character_amount;
@@ -2208,347 +2854,61 @@ static bool printf_output_specifier_integer_iduoxX(printf_core_ref _Nonnull core
         }
 #endif
         
-        if(core->type == printf_type_FILE) {
-            if(core->output.file != NULL) {
-                if(need_consider_width) {
-                    DEBUG_ASSERT(width_addition_amount > 0);
-                    if(width_using_zero_padding) {
-                        // sign output
-                        if(sign == printf_sign_plus) putc(CHARACTER_plus, core->output.file);
-                        else if(sign == printf_sign_minus) putc(CHARACTER_minus, core->output.file);
-                        else if(sign == printf_sign_space) putc(CHARACTER_space, core->output.file);
-                        
-                        // prefix output
-                        if(prefix == printf_complex_prefix_0) putc(CHARACTER_0, core->output.file);
-                        else if(prefix == printf_complex_prefix_0x) {
-                            putc(CHARACTER_0, core->output.file);
-                            putc(CHARACTER_x, core->output.file);
-                        }
-                        else if(prefix == printf_complex_prefix_0X) {
-                            putc(CHARACTER_0, core->output.file);
-                            putc(CHARACTER_X, core->output.file);
-                        }
-                        
-                        // width zero padding output
-                        for(size_t index = 0; index < width_addition_amount; index++)
-                            putc(CHARACTER_0, core->output.file);
-                        
-                        if(!zero_no_digit) {
-                            for(size_t index = 0; index < precision_padding_zero; index++)
-                                putc(CHARACTER_0, core->output.file);
-                            if(interprate->type == printf_specifier_d_or_i || interprate->type == printf_specifier_u) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base10_character));
-                                    putc(base10_character[eachDigits[count - 1]], core->output.file);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_o) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base8_character));
-                                    putc(base8_character[eachDigits[count - 1]], core->output.file);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_x) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_lowercase));
-                                    putc(base16_character_lowercase[eachDigits[count - 1]], core->output.file);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_X) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_uppercase));
-                                    putc(base16_character_uppercase[eachDigits[count - 1]], core->output.file);
-                                }
-                            } ELSE_DEBUG_RETURN(false);
-                        }
-                    }
-                    else {
-                        bool space_added_to_left = !(interprate->flag & printf_interprate_flag_left_justify);
-                        
-                        // space output
-                        if(space_added_to_left) for(size_t index = 0; index < width_addition_amount; index++)
-                            fputc(CHARACTER_space, core->output.file);
-                        
-                        // sign output
-                        if(sign == printf_sign_plus) putc(CHARACTER_plus, core->output.file);
-                        else if(sign == printf_sign_minus) putc(CHARACTER_minus, core->output.file);
-                        else if(sign == printf_sign_space) putc(CHARACTER_space, core->output.file);
-                        
-                        // prefix output
-                        if(prefix == printf_complex_prefix_0) putc(CHARACTER_0, core->output.file);
-                        else if(prefix == printf_complex_prefix_0x) {
-                            putc(CHARACTER_0, core->output.file);
-                            putc(CHARACTER_x, core->output.file);
-                        }
-                        else if(prefix == printf_complex_prefix_0X) {
-                            putc(CHARACTER_0, core->output.file);
-                            putc(CHARACTER_X, core->output.file);
-                        }
-                        
-                        if(!zero_no_digit) {
-                            for(size_t index = 0; index < precision_padding_zero; index++)
-                                putc(CHARACTER_0, core->output.file);
-                            if(interprate->type == printf_specifier_d_or_i || interprate->type == printf_specifier_u) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base10_character));
-                                    putc(base10_character[eachDigits[count - 1]], core->output.file);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_o) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base8_character));
-                                    putc(base8_character[eachDigits[count - 1]], core->output.file);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_x) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_lowercase));
-                                    putc(base16_character_lowercase[eachDigits[count - 1]], core->output.file);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_X) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_uppercase));
-                                    putc(base16_character_uppercase[eachDigits[count - 1]], core->output.file);
-                                }
-                            } ELSE_DEBUG_RETURN(false);
-                        }
-                        
-                        // space output
-                        if(!space_added_to_left) for(size_t index = 0; index < width_addition_amount; index++)
-                            fputc(CHARACTER_space, core->output.file);
-                    }
-                }
-                else {
-                    // sign output
-                    if(sign == printf_sign_plus) putc(CHARACTER_plus, core->output.file);
-                    else if(sign == printf_sign_minus) putc(CHARACTER_minus, core->output.file);
-                    else if(sign == printf_sign_space) putc(CHARACTER_space, core->output.file);
-                    
-                    // prefix output
-                    if(prefix == printf_complex_prefix_0) putc(CHARACTER_0, core->output.file);
-                    else if(prefix == printf_complex_prefix_0x) {
-                        putc(CHARACTER_0, core->output.file);
-                        putc(CHARACTER_x, core->output.file);
-                    }
-                    else if(prefix == printf_complex_prefix_0X) {
-                        putc(CHARACTER_0, core->output.file);
-                        putc(CHARACTER_X, core->output.file);
-                    }
-                    
-                    if(!zero_no_digit) {
-                        for(size_t index = 0; index < precision_padding_zero; index++)
-                            putc(CHARACTER_0, core->output.file);
-                        if(interprate->type == printf_specifier_d_or_i || interprate->type == printf_specifier_u) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base10_character));
-                                putc(base10_character[eachDigits[count - 1]], core->output.file);
-                            }
-                        }
-                        else if(interprate->type == printf_specifier_o) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base8_character));
-                                putc(base8_character[eachDigits[count - 1]], core->output.file);
-                            }
-                        }
-                        else if(interprate->type == printf_specifier_x) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_lowercase));
-                                putc(base16_character_lowercase[eachDigits[count - 1]], core->output.file);
-                            }
-                        }
-                        else if(interprate->type == printf_specifier_X) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_uppercase));
-                                putc(base16_character_uppercase[eachDigits[count - 1]], core->output.file);
-                            }
-                        } ELSE_DEBUG_RETURN(false);
-                    }
-                }
-            } ELSE_DEBUG_RETURN(false);
+        // sign and prefix
+        UTF8Char head[3]; size_t head_length = 0;
+        if(sign == printf_sign_plus) head[head_length++] = CHARACTER_plus;
+        else if(sign == printf_sign_minus) head[head_length++] = CHARACTER_minus;
+        else if(sign == printf_sign_space) head[head_length++] = CHARACTER_space;
+        
+        if(prefix == printf_complex_prefix_0) head[head_length++] = CHARACTER_0;
+        else if(prefix == printf_complex_prefix_0x) {
+            head[head_length++] = CHARACTER_0;
+            head[head_length++] = CHARACTER_x;
         }
-        else if(core->type == printf_type_string) {
-            if(core->output.string.store != NULL && core->output.string.index + 1 < core->output.string.count) {
-                
-                size_t max_store_amount = core->output.string.count - core->output.string.index - 1;
-                size_t current_stored = 0;
-                
-#ifdef PF_TRY_STORE
-#Warning PF_TRY_STORE predefined unexpected condition
-#undef PF_TRY_STORE
+        else if(prefix == printf_complex_prefix_0X) {
+            head[head_length++] = CHARACTER_0;
+            head[head_length++] = CHARACTER_X;
+        }
+        
+        // zeros between head and digits, width padding goes first
+        size_t zero_padding_amount = zero_no_digit ? 0 : precision_padding_zero;
+        size_t space_padding_amount = 0;
+        if(need_consider_width) {
+            DEBUG_ASSERT(width_addition_amount > 0);
+            if(width_using_zero_padding) zero_padding_amount += width_addition_amount;
+            else space_padding_amount = width_addition_amount;
+        }
+        
+        bool space_added_to_left = !(interprate->flag & printf_interprate_flag_left_justify);
+        
+        const UTF8Char *body = digits;
+        size_t body_length = zero_no_digit ? 0 : digits_amount;
+        
+#ifdef DEBUG
+        size_t previous_actual_need = core->actual_need;
 #endif
-
-    // [WARNING] this macro did not append trailing null character [mind]
-#define PF_TRY_STORE(uint8_byte) do {                                           \
-                    if(current_stored < max_store_amount) {                     \
-                         core->output.string.store                              \
-                        [core->output.string.index++] = (uint8_byte);           \
-                         current_stored++; }} while(0)
-                
-                if(need_consider_width) {
-                    DEBUG_ASSERT(width_addition_amount > 0);
-                    if(width_using_zero_padding) {
-                        // sign output
-                        if(sign == printf_sign_plus) PF_TRY_STORE(CHARACTER_plus);
-                        else if(sign == printf_sign_minus) PF_TRY_STORE(CHARACTER_minus);
-                        else if(sign == printf_sign_space) PF_TRY_STORE(CHARACTER_space);
-                        
-                        // prefix output
-                        if(prefix == printf_complex_prefix_0) PF_TRY_STORE(CHARACTER_0);
-                        else if(prefix == printf_complex_prefix_0x) {
-                            PF_TRY_STORE(CHARACTER_0);
-                            PF_TRY_STORE(CHARACTER_x);
-                        }
-                        else if(prefix == printf_complex_prefix_0X) {
-                            PF_TRY_STORE(CHARACTER_0);
-                            PF_TRY_STORE(CHARACTER_X);
-                        }
-                        
-                        // width zero padding output
-                        for(size_t index = 0; index < width_addition_amount; index++)
-                            PF_TRY_STORE(CHARACTER_0);
-                        
-                        if(!zero_no_digit) {
-                            for(size_t index = 0; index < precision_padding_zero; index++)
-                                PF_TRY_STORE(CHARACTER_0);
-                            
-                            if(interprate->type == printf_specifier_d_or_i || interprate->type == printf_specifier_u) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base10_character));
-                                    PF_TRY_STORE(base10_character[eachDigits[count - 1]]);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_o) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base8_character));
-                                    PF_TRY_STORE(base8_character[eachDigits[count - 1]]);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_x) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_lowercase));
-                                    PF_TRY_STORE(base16_character_lowercase[eachDigits[count - 1]]);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_X) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_uppercase));
-                                    PF_TRY_STORE(base16_character_uppercase[eachDigits[count - 1]]);
-                                }
-                            } ELSE_DEBUG_RETURN(false);
-                        }
-                    }
-                    else {
-                        bool space_added_to_left = !(interprate->flag & printf_interprate_flag_left_justify);
-                        
-                        // space output
-                        if(space_added_to_left) for(size_t index = 0; index < width_addition_amount; index++)
-                            PF_TRY_STORE(CHARACTER_space);
-                        
-                        // sign output
-                        if(sign == printf_sign_plus) PF_TRY_STORE(CHARACTER_plus);
-                        else if(sign == printf_sign_minus) PF_TRY_STORE(CHARACTER_minus);
-                        else if(sign == printf_sign_space) PF_TRY_STORE(CHARACTER_space);
-                        
-                        // prefix output
-                        if(prefix == printf_complex_prefix_0) PF_TRY_STORE(CHARACTER_0);
-                        else if(prefix == printf_complex_prefix_0x) {
-                            PF_TRY_STORE(CHARACTER_0);
-                            PF_TRY_STORE(CHARACTER_x);
-                        }
-                        else if(prefix == printf_complex_prefix_0X) {
-                            PF_TRY_STORE(CHARACTER_0);
-                            PF_TRY_STORE(CHARACTER_X);
-                        }
-                        
-                        if(!zero_no_digit) {
-                            for(size_t index = 0; index < precision_padding_zero; index++)
-                                PF_TRY_STORE(CHARACTER_0);
-                            if(interprate->type == printf_specifier_d_or_i || interprate->type == printf_specifier_u) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base10_character));
-                                    PF_TRY_STORE(base10_character[eachDigits[count - 1]]);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_o) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base8_character));
-                                    PF_TRY_STORE(base8_character[eachDigits[count - 1]]);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_x) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_lowercase));
-                                    PF_TRY_STORE(base16_character_lowercase[eachDigits[count - 1]]);
-                                }
-                            }
-                            else if(interprate->type == printf_specifier_X) {
-                                for(size_t count = digits_amount; count > 0; count--) {
-                                    DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_uppercase));
-                                    PF_TRY_STORE(base16_character_uppercase[eachDigits[count - 1]]);
-                                }
-                            } ELSE_DEBUG_RETURN(false);
-                        }
-                        
-                        // space output
-                        if(!space_added_to_left) for(size_t index = 0; index < width_addition_amount; index++)
-                            PF_TRY_STORE(CHARACTER_space);
-                    }
-                }
-                else {
-                    // sign output
-                    if(sign == printf_sign_plus) PF_TRY_STORE(CHARACTER_plus);
-                    else if(sign == printf_sign_minus) PF_TRY_STORE(CHARACTER_minus);
-                    else if(sign == printf_sign_space) PF_TRY_STORE(CHARACTER_space);
-                    
-                    // prefix output
-                    if(prefix == printf_complex_prefix_0) PF_TRY_STORE(CHARACTER_0);
-                    else if(prefix == printf_complex_prefix_0x) {
-                        PF_TRY_STORE(CHARACTER_0);
-                        PF_TRY_STORE(CHARACTER_x);
-                    }
-                    else if(prefix == printf_complex_prefix_0X) {
-                        PF_TRY_STORE(CHARACTER_0);
-                        PF_TRY_STORE(CHARACTER_X);
-                    }
-                    
-                    if(!zero_no_digit) {
-                        for(size_t index = 0; index < precision_padding_zero; index++)
-                            PF_TRY_STORE(CHARACTER_0);
-                        if(interprate->type == printf_specifier_d_or_i || interprate->type == printf_specifier_u) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base10_character));
-                                PF_TRY_STORE(base10_character[eachDigits[count - 1]]);
-                            }
-                        }
-                        else if(interprate->type == printf_specifier_o) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base8_character));
-                                PF_TRY_STORE(base8_character[eachDigits[count - 1]]);
-                            }
-                        }
-                        else if(interprate->type == printf_specifier_x) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_lowercase));
-                                PF_TRY_STORE(base16_character_lowercase[eachDigits[count - 1]]);
-                            }
-                        }
-                        else if(interprate->type == printf_specifier_X) {
-                            for(size_t count = digits_amount; count > 0; count--) {
-                                DEBUG_ASSERT(eachDigits[count - 1] < ARRAY_SIZE(base16_character_uppercase));
-                                PF_TRY_STORE(base16_character_uppercase[eachDigits[count - 1]]);
-                            }
-                        } ELSE_DEBUG_RETURN(false);
-                    }
-                }
-#undef PF_TRY_STORE
-                // even output nothing this is valid
-                core->output.string.store[core->output.string.index] = CHARACTER_null;
-            }
-        } ELSE_DEBUG_RETURN(false);
         
-        // increase core->actual_need
-        core->actual_need += full_output_character_amount;
+        // space output
+        if(space_added_to_left) printf_core_output_fill(core, CHARACTER_space, space_padding_amount);
+        
+        if(zero_padding_amount == 0) {
+            // head is put right before digits, output at once
+            DEBUG_ASSERT(digits >= buffer + head_length);
+            digits -= head_length;
+            __builtin_memcpy(digits, head, head_length);
+            body = digits;
+            body_length += head_length;
+        }
+        else {
+            printf_core_output_raw_bytes(core, head, head_length);
+            printf_core_output_fill(core, CHARACTER_0, zero_padding_amount);
+        }
+        printf_core_output_raw_bytes(core, body, body_length);
+        
+        // space output
+        if(!space_added_to_left) printf_core_output_fill(core, CHARACTER_space, space_padding_amount);
+        
+        DEBUG_ASSERT(core->actual_need - previous_actual_need == full_output_character_amount);
         
         return true;        // process success point
         
@@ -2570,24 +2930,180 @@ typedef struct floating_point_base_convert_type {
     uint32_t base_value;
     long exponent;
     size_t length;
+    size_t active_length;   // elements any number or intermediate could reach, not more than length
+    // shortest, fixed or exact digits prepared ahead [most significant first], queried instead of remain / scale
+    uint8_t * _Nullable digits;     // digits_storage, or scratch allocation for more exact digits
+    uint8_t digits_storage[FP32_EXACT_DIGITS_MAX];
+    unsigned int digits_amount;     // zero if not prepared
+    unsigned int digits_index;
 } fpbc_t;
 
 typedef fpbc_t * fpbc_ref;
 
+/*!
+    @function floating_point_base_convert_setup_active_length_inline
+    @abstract active_length set to the longest number plus one element
+    @discussion each step scales a number by at most 2 x base + 1, which one more element could hold
+    @return updated active_length
+ */
+static inline size_t floating_point_base_convert_setup_active_length_inline(fpbc_ref _Nonnull fpbc) {
+    size_t used_length = extended_integer_used_length(fpbc->remain, fpbc->length);
+    size_t temp = extended_integer_used_length(fpbc->scale, fpbc->length);
+    if(temp > used_length) used_length = temp;
+    temp = extended_integer_used_length(fpbc->nearby_down, fpbc->length);
+    if(temp > used_length) used_length = temp;
+    temp = extended_integer_used_length(fpbc->nearby_up, fpbc->length);
+    if(temp > used_length) used_length = temp;
+    fpbc->active_length = used_length + 1 < fpbc->length ? used_length + 1 : fpbc->length;
+    return fpbc->active_length;
+}
+
+/*!
+    @function floating_point_base_convert_grow_active_length_inline
+    @abstract called after each step, one more element if the highest active one is reached
+    @discussion numbers never shrink below the longest one [ remain is less than scale after fix up ]
+    @return updated active_length
+ */
+static inline size_t floating_point_base_convert_grow_active_length_inline(fpbc_ref _Nonnull fpbc) {
+    size_t top = fpbc->active_length - 1;
+    if(fpbc->active_length < fpbc->length &&
+       (fpbc->remain[top] | fpbc->scale[top] | fpbc->nearby_down[top] | fpbc->nearby_up[top]) != 0)
+        fpbc->active_length++;
+    return fpbc->active_length;
+}
+
+/*!
+    @function floating_point_base_convert_prepare_digits_inline
+    @abstract digits of [value x 10^(exponent)] queried instead of remain / scale, no extended_integer is needed after
+    @discussion zero value is kept as a single digit
+ */
+static inline bool floating_point_base_convert_prepare_digits_inline(fpbc_ref _Nonnull fpbc,
+                                                                     uint64_t value,
+                                                                     long exponent) {
+    unsigned int digits_amount = printf_integer_decimal_digits_amount_inline(value);
+    if(digits_amount > ARRAY_SIZE(fpbc->digits_storage)) DEBUG_RETURN(false);
+    
+    fpbc->digits = fpbc->digits_storage;
+    for(unsigned int index = digits_amount; index > 0; index--, value /= 10)
+        fpbc->digits[index - 1] = (uint8_t)(value % 10);
+    
+    fpbc->digits_amount = digits_amount;
+    fpbc->digits_index = 0;
+    fpbc->exponent = exponent + (long)digits_amount;       // same as after simple fix up
+    fpbc->base_value = UINT32_C(10);
+    fpbc->length = 0;
+    fpbc->active_length = 0;
+    return true;
+}
+
+/*!
+    @function floating_point_base_convert_digits_kept_inline
+    @abstract significant digits [fFeEgG] keeps of value 0.[digits] x 10^(exponent), zero or negative for [fF] if none
+ */
+static inline bool floating_point_base_convert_digits_kept_inline(printf_interprate_ref _Nonnull interprate,
+                                                                  long exponent,
+                                                                  long * _Nonnull keep) {
+    switch (interprate->type) {
+        case printf_specifier_f:
+        case printf_specifier_F:
+            keep[0] = exponent + (long)interprate->precision;
+            return true;
+        case printf_specifier_e:
+        case printf_specifier_E:
+            keep[0] = (long)interprate->precision + 1;
+            return true;
+        case printf_specifier_g:
+        case printf_specifier_G:
+            keep[0] = interprate->precision > 0 ? (long)interprate->precision : 1;
+            return true;
+        default: DEBUG_RETURN(false);
+    }
+}
+
+/*!
+    @function floating_point_base_convert_round_digits
+    @abstract round fpbc->digits of value 0.[digits] x 10^(exponent) to the digits kept, ties to even
+    @discussion no rounding is left for the specifier after
+    @param sticky true if any digit beyond amount is not zero
+ */
+static bool floating_point_base_convert_round_digits(printf_interprate_ref _Nonnull interprate,
+                                                     fpbc_ref _Nonnull fpbc,
+                                                     unsigned int amount,
+                                                     long exponent,
+                                                     bool sticky) {
+    if(interprate != NULL && fpbc != NULL && fpbc->digits != NULL && amount > 0) {
+        long keep;
+        if(!floating_point_base_convert_digits_kept_inline(interprate, exponent, &keep)) DEBUG_RETURN(false);
+        
+        if(keep < (long)amount) {
+            // first removed digit against half, the rest as sticky bit
+            uint8_t removed = keep >= 0 ? fpbc->digits[keep] : 0;
+            for(unsigned int index = (unsigned int)(keep >= 0 ? keep + 1 : 0); index < amount; index++)
+                sticky |= fpbc->digits[index] != 0;
+            bool odd = keep > 0 && (fpbc->digits[keep - 1] & 1);
+            bool round_up = keep >= 0 && (removed > 5 || (removed == 5 && (sticky || odd)));
+            
+            if(keep <= 0) {
+                // only [fF] drops every digit, 0 or 1 at 10^(-precision)
+                fpbc->digits[0] = round_up;
+                amount = 1;
+                exponent = 1 - (long)interprate->precision;
+            }
+            else {
+                amount = (unsigned int)keep;
+                for(unsigned int index = amount; round_up && index > 0; index--) {
+                    round_up = fpbc->digits[index - 1] == 9;
+                    fpbc->digits[index - 1] = round_up ? 0 : fpbc->digits[index - 1] + 1;
+                }
+                if(round_up) {
+                    // 9.99 rounded to 10.0
+                    fpbc->digits[0] = 1;
+                    amount = 1;
+                    exponent++;
+                }
+            }
+        }
+        
+        fpbc->digits_amount = amount;
+        fpbc->digits_index = 0;
+        fpbc->exponent = exponent;
+        fpbc->base_value = UINT32_C(10);
+        fpbc->length = 0;
+        fpbc->active_length = 0;
+        return true;
+    } DEBUG_ELSE
+    return false;
+}
+
 #pragma mark floating point simple fix up
 
+/*!
+    @function floating_point_base_convert_exponent_estimate_inline
+    @abstract ceil(d x log10(2)) with log10(2) as 1292913986 / 2^(32), exact for |d| up to 40000
+    @discussion for v within [2^(d), 2^(d+1)) the exponent found by simple fix up is this or one more
+ */
+static inline long floating_point_base_convert_exponent_estimate_inline(long bit_difference) {
+    DEBUG_ASSERT(bit_difference > -40000 && bit_difference < 40000);
+    if(bit_difference == 0) return 0;
+    // floor by arithmetic shift, d x log10(2) is never an integer
+    return (long)(((int64_t)bit_difference * INT64_C(1292913986)) >> 32) + 1;
+}
+
 static bool printf_output_specifier_floating_point_fpbc_simple_fixup(fp_info_ref _Nonnull info,
                                                                      fpbc_ref _Nonnull fpbc,
                                                                      bool nearby_down_decrease_exponent) {
     if(info != NULL && fpbc != NULL) {
+        SCRATCH_ARENA_SCOPE;
         // e - p
         // [positive] could just store significand(with implicit one) offseted (e - p)
-        // [negative] max[ (need_for_query_significand_bit + 1), e_minus_p + 1 ]
+        // [negative] max[ (significand_bit_amount + 1), e_minus_p + 1 ]
         
-        size_t length = fpbc->length;
+        EXT_ARRAY temp1 = printf_scratch_alloc(sizeof(EXT_TYPE) * fpbc->length);
+        EXT_ARRAY temp2 = printf_scratch_alloc(sizeof(EXT_TYPE) * fpbc->length);
+        if(temp1 == NULL || temp2 == NULL) DEBUG_RETURN(false);
         
-        EXT_ARRAY temp1 = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-        EXT_ARRAY temp2 = printf_stack_alloc(sizeof(EXT_TYPE) * length);
+        // only significand elements are calculated from now on
+        size_t length = floating_point_base_convert_setup_active_length_inline(fpbc);
         
         if(nearby_down_decrease_exponent) {
             // nearby_down_decrease_exponent need even more one
@@ -2603,36 +3119,63 @@ static bool printf_output_specifier_floating_point_fpbc_simple_fixup(fp_info_ref
             // scale
             extended_integer_bit_offset(fpbc->scale, temp1, length, 1);
             extended_integer_copy(temp1, fpbc->scale, length);
+            
+            length = floating_point_base_convert_grow_active_length_inline(fpbc);
         }
         
         bool error_flag;
         
-        long exponent = 0;
-// [NOTE] [optimization] exponent range overflow detect [not likely]
+        // scale is a power of two, remain / scale within [2^(d), 2^(d+1)) for d the bit length difference
+        long bit_difference = (long)extended_integer_bit_length(fpbc->remain, fpbc->length) -
+                              (long)extended_integer_bit_length(fpbc->scale, fpbc->length);
+        long exponent = floating_point_base_convert_exponent_estimate_inline(bit_difference);
         
-        LOOP {
-            // v            (remain       / scale) x Base^(k)
-            // v - v(-)     (nearby_minus / scale) x Base^(k)
-            // v(+) - v     (nearby_plus  / scale) x Base^(k)
+        // power built in full length, numbers could grow by many elements at once
+        if(exponent > 0) {
+            // scale scaled to B^(k)
+            extended_integer_pow_uint32(fpbc->base_value, (uint32_t)exponent, temp1, fpbc->length, &error_flag);
+            if(error_flag) DEBUG_RETURN(false);
+            extended_integer_multiply(fpbc->scale, temp1, temp2, fpbc->length, &error_flag);
+            if(error_flag) DEBUG_RETURN(false);
+            extended_integer_copy(temp2, fpbc->scale, fpbc->length);
+        }
+        else if(exponent < 0) {
+            // remain & nearby_down & nearby_up scale B^(-k-1) first, estimated k may be one less
+            if(exponent < -1) {
+                extended_integer_pow_uint32(fpbc->base_value, (uint32_t)(- exponent - 1), temp1, fpbc->length, &error_flag);
+                if(error_flag) DEBUG_RETURN(false);
+                EXT_ARRAY numbers[] = { fpbc->remain, fpbc->nearby_down, fpbc->nearby_up };
+                for(size_t index = 0; index < ARRAY_SIZE(numbers); index++) {
+                    extended_integer_multiply(numbers[index], temp1, temp2, fpbc->length, &error_flag);
+                    if(error_flag) DEBUG_RETURN(false);
+                    extended_integer_copy(temp2, numbers[index], fpbc->length);
+                }
+            }
             
-            extended_integer_divide(fpbc->scale, fpbc->base, temp1, length, &error_flag);
+            // temp1 = B x ((2 x remain) + nearby_up)
+            extended_integer_quick_multiply_add(fpbc->remain, 2, fpbc->nearby_up, temp1, fpbc->length, &error_flag);
+            if(error_flag) DEBUG_RETURN(false);
+            extended_integer_quick_multiply(temp1, fpbc->base_value, fpbc->length, &error_flag);
+            if(error_flag) DEBUG_RETURN(false);
+            
+            // temp2 = 2 x scale
+            extended_integer_add(fpbc->scale, fpbc->scale, temp2, fpbc->length, &error_flag);
             if(error_flag) DEBUG_RETURN(false);
             
-            // temp = scale / base
-            if(extended_integer_compare(fpbc->remain, temp1, length) < 0) {
-                DEBUG_ASSERT(exponent != INT_MIN);
-                exponent--;
-                extended_integer_quick_multiply(fpbc->remain, fpbc->base_value, length, &error_flag);
+            // estimate holds if (v + v(+)) / 2 still not more than B^(k) with the last B applied
+            if(extended_integer_compare(temp1, temp2, fpbc->length) <= 0) {
+                extended_integer_quick_multiply(fpbc->remain, fpbc->base_value, fpbc->length, &error_flag);
                 if(error_flag) DEBUG_RETURN(false);
-                extended_integer_quick_multiply(fpbc->nearby_down, fpbc->base_value, length, &error_flag);
+                extended_integer_quick_multiply(fpbc->nearby_down, fpbc->base_value, fpbc->length, &error_flag);
                 if(error_flag) DEBUG_RETURN(false);
-                extended_integer_quick_multiply(fpbc->nearby_up, fpbc->base_value, length, &error_flag);
+                extended_integer_quick_multiply(fpbc->nearby_up, fpbc->base_value, fpbc->length, &error_flag);
                 if(error_flag) DEBUG_RETURN(false);
-                // remain & nearby_down & nearby_up scale B size
             }
-            else break;     // exit LOOP
+            else exponent++;
         }
-        // exponent = min{0, 1 + [log(B, v)]}
+        length = floating_point_base_convert_setup_active_length_inline(fpbc);
+        
+        // estimate one less, runs at most once
         LOOP {
             // v            (remain       / scale) x Base^(k)
             // v - v(-)     (nearby_minus / scale) x Base^(k)
@@ -2641,20 +3184,19 @@ static bool printf_output_specifier_floating_point_fpbc_simple_fixup(fp_info_ref
             // remain sacled two plus nearby_up
             
             // temp1 = (2 x remain) + nearby_up
-            extended_integer_add(fpbc->remain, fpbc->remain, temp2, length, &error_flag);
-            if(error_flag) DEBUG_RETURN(false);
-            extended_integer_add(temp2, fpbc->nearby_up, temp1, length, &error_flag);
+            extended_integer_quick_multiply_add(fpbc->remain, 2, fpbc->nearby_up, temp1, length, &error_flag);
             if(error_flag) DEBUG_RETURN(false);
             
             // temp2 = 2 x scale
             extended_integer_add(fpbc->scale, fpbc->scale, temp2, length, &error_flag);
             if(error_flag) DEBUG_RETURN(false);
             
-            if(extended_integer_compare(temp1, temp2, length) >= 0) {
+            // v + v(+) / 2 exactly at B^(k) is not in range, nearby bounds are exclusive
+            if(extended_integer_compare(temp1, temp2, length) > 0) {
                 // scale scaled to B
-                extended_integer_multiply(fpbc->scale, fpbc->base, temp1, length, &error_flag);
+                extended_integer_quick_multiply(fpbc->scale, fpbc->base_value, length, &error_flag);
                 if(error_flag) DEBUG_RETURN(false);
-                extended_integer_copy(temp1, fpbc->scale, length);
+                length = floating_point_base_convert_grow_active_length_inline(fpbc);
                 exponent++;
             }
             else break;
@@ -2673,6 +3215,16 @@ static bool floating_point_base_convert_query_next_digit(fpbc_ref _Nonnull fpbc,
                                                          uint32_t * _Nonnull value,
                                                          bool * _Nonnull complete) {
     if(fpbc != NULL && exponent != NULL && value != NULL && complete != NULL) {
+        SCRATCH_ARENA_SCOPE;
+        
+        if(fpbc->digits_amount > 0) {
+            DEBUG_ASSERT(fpbc->digits_index < fpbc->digits_amount);
+            fpbc->exponent = fpbc->exponent - 1;
+            exponent[0] = fpbc->exponent;
+            value[0] = fpbc->digits[fpbc->digits_index++];
+            complete[0] = fpbc->digits_index == fpbc->digits_amount;
+            return true;
+        }
         
         /* fpbc var */
         EXT_ARRAY remain = fpbc->remain;                DEBUG_ASSERT(remain != 0);
@@ -2680,16 +3232,18 @@ static bool floating_point_base_convert_query_next_digit(fpbc_ref _Nonnull fpbc,
         EXT_ARRAY nearby_up = fpbc->nearby_up;          DEBUG_ASSERT(nearby_up != 0);
         EXT_ARRAY nearby_down = fpbc->nearby_down;      DEBUG_ASSERT(nearby_down != 0);
         uint32_t base_value = fpbc->base_value;         DEBUG_ASSERT(base_value > 0);
-        size_t length = fpbc->length;                   DEBUG_ASSERT(length > 0);
+        size_t length = fpbc->active_length;            DEBUG_ASSERT(length > 0);
         
         /* temp var */
         bool error_flag;
-        uint32_t current;
+        EXT_TYPE current;
         bool low, high;
         
-        EXT_ARRAY remain_times_two = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-        EXT_ARRAY sacle_times_two = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-        EXT_ARRAY scale_times_two_minus_nearby_up = printf_stack_alloc(sizeof(EXT_TYPE) * length);
+        EXT_ARRAY remain_times_two = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+        EXT_ARRAY sacle_times_two = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+        EXT_ARRAY scale_times_two_minus_nearby_up = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+        if(remain_times_two == NULL || sacle_times_two == NULL || scale_times_two_minus_nearby_up == NULL)
+            DEBUG_RETURN(false);
         
         // remain / scale * base ^ (k) + SUM(H, i = k, Di * B^(i)) == value
         fpbc->exponent = fpbc->exponent - 1;    // current output exponent
@@ -2707,6 +3261,9 @@ static bool floating_point_base_convert_query_next_digit(fpbc_ref _Nonnull fpbc,
         extended_integer_quick_multiply(nearby_up, base_value, length, &error_flag);
         if(error_flag) DEBUG_RETURN(false);
         
+        // next digit calculated within updated active elements, this one keeps length
+        floating_point_base_convert_grow_active_length_inline(fpbc);
+        
         extended_integer_bit_offset(remain, remain_times_two, length, 1);   // scale by two
         
         low  = extended_integer_compare(remain_times_two, nearby_down, length) < 0;
@@ -2764,99 +3321,1198 @@ static inline bool floating_point_base_convert_try_next_exponent_inline(fpbc_ref
     return 0u;
 }
 
-#pragma mark floating point subnormal types
+#pragma mark floating point shortest digits [binary 64]
+
+#if defined PRINTF_FLOATING_POINT_SHORTEST_64 || defined PRINTF_FLOATING_POINT_SHORTEST_32
+
+// [Documentation] Ulf Adams, Ryu: fast float-to-string conversion (PLDI 2018)
+// 5^(i) and 2^(k) / 5^(i) normalized to 125 bit, stored as [low 64 bit, high 64 bit]
+
+#define FP64_SHORTEST_POW5_INVERSE_BIT          125
+#define FP64_SHORTEST_POW5_BIT                  125
+#define FP64_SHORTEST_POW5_INVERSE_TABLE_SIZE   342
+#define FP64_SHORTEST_POW5_TABLE_SIZE           326
+
+static const uint64_t fp64_shortest_pow5_inverse_split[FP64_SHORTEST_POW5_INVERSE_TABLE_SIZE][2] = {
+    { UINT64_C(0x0000000000000001), UINT64_C(0x2000000000000000) }, { UINT64_C(0x999999999999999a), UINT64_C(0x1999999999999999) },
+    { UINT64_C(0x47ae147ae147ae15), UINT64_C(0x147ae147ae147ae1) }, { UINT64_C(0x6c8b4395810624de), UINT64_C(0x10624dd2f1a9fbe7) },
+    { UINT64_C(0x7a786c226809d496), UINT64_C(0x1a36e2eb1c432ca5) }, { UINT64_C(0x61f9f01b866e43ab), UINT64_C(0x14f8b588e368f084) },
+    { UINT64_C(0xb4c7f34938583622), UINT64_C(0x10c6f7a0b5ed8d36) }, { UINT64_C(0x87a6520ec08d236a), UINT64_C(0x1ad7f29abcaf4857) },
+    { UINT64_C(0x9fb841a566d74f88), UINT64_C(0x15798ee2308c39df) }, { UINT64_C(0xe62d01511f12a607), UINT64_C(0x112e0be826d694b2) },
+    { UINT64_C(0xd6ae6881cb5109a4), UINT64_C(0x1b7cdfd9d7bdbab7) }, { UINT64_C(0xdef1ed34a2a73aea), UINT64_C(0x15fd7fe17964955f) },
+    { UINT64_C(0x7f27f0f6e885c8bb), UINT64_C(0x119799812dea1119) }, { UINT64_C(0x650cb4be40d60df8), UINT64_C(0x1c25c268497681c2) },
+    { UINT64_C(0xea70909833de7193), UINT64_C(0x16849b86a12b9b01) }, { UINT64_C(0x21f3a6e0297ec143), UINT64_C(0x1203af9ee756159b) },
+    { UINT64_C(0x6985d7cd0f313537), UINT64_C(0x1cd2b297d889bc2b) }, { UINT64_C(0x2137dfd73f5a90f9), UINT64_C(0x170ef54646d49689) },
+    { UINT64_C(0xe75fe645cc4873fa), UINT64_C(0x12725dd1d243aba0) }, { UINT64_C(0xa5663d3c7a0d865d), UINT64_C(0x1d83c94fb6d2ac34) },
+    { UINT64_C(0x511e976394d79eb1), UINT64_C(0x179ca10c9242235d) }, { UINT64_C(0xda7edf82dd794bc1), UINT64_C(0x12e3b40a0e9b4f7d) },
+    { UINT64_C(0x2a6498d1625bac68), UINT64_C(0x1e392010175ee596) }, { UINT64_C(0xeeb6e0a781e2f053), UINT64_C(0x182db34012b25144) },
+    { UINT64_C(0x58924d52ce4f26a9), UINT64_C(0x1357c299a88ea76a) }, { UINT64_C(0x27507bb7b07ea441), UINT64_C(0x1ef2d0f5da7dd8aa) },
+    { UINT64_C(0x52a6c95fc0655034), UINT64_C(0x18c240c4aecb13bb) }, { UINT64_C(0x0eebd44c99eaa690), UINT64_C(0x13ce9a36f23c0fc9) },
+    { UINT64_C(0xb17953adc3110a80), UINT64_C(0x1fb0f6be50601941) }, { UINT64_C(0xc12ddc8b02740867), UINT64_C(0x195a5efea6b34767) },
+    { UINT64_C(0x3424b06f3529a052), UINT64_C(0x14484bfeebc29f86) }, { UINT64_C(0x901d59f290ee19db), UINT64_C(0x1039d66589687f9e) },
+    { UINT64_C(0x4cfbc31db4b0295f), UINT64_C(0x19f623d5a8a73297) }, { UINT64_C(0x3d9635b15d59bab2), UINT64_C(0x14c4e977ba1f5bac) },
+    { UINT64_C(0x97ab5e277de16228), UINT64_C(0x109d8792fb4c4956) }, { UINT64_C(0xf2abc9d8c9689d0d), UINT64_C(0x1a95a5b7f87a0ef0) },
+    { UINT64_C(0x5bbca17a3aba173e), UINT64_C(0x154484932d2e725a) }, { UINT64_C(0xafca1ac82efb45cb), UINT64_C(0x11039d428a8b8eae) },
+    { UINT64_C(0xb2dcf7a6b1920945), UINT64_C(0x1b38fb9daa78e44a) }, { UINT64_C(0xf57d92ebc141a104), UINT64_C(0x15c72fb1552d836e) },
+    { UINT64_C(0xc46475896767b403), UINT64_C(0x116c262777579c58) }, { UINT64_C(0x6d6d88dbd8a5ecd2), UINT64_C(0x1be03d0bf225c6f4) },
+    { UINT64_C(0x8abe071646eb23db), UINT64_C(0x164cfda3281e38c3) }, { UINT64_C(0x6efe6c11d255b649), UINT64_C(0x11d7314f534b609c) },
+    { UINT64_C(0xb197134fb6ef8a0e), UINT64_C(0x1c8b821885456760) }, { UINT64_C(0x27ac0f72f8bfa1a5), UINT64_C(0x16d601ad376ab91a) },
+    { UINT64_C(0xb95672c260994e1e), UINT64_C(0x1244ce242c5560e1) }, { UINT64_C(0xf5571e03cdc21695), UINT64_C(0x1d3ae36d13bbce35) },
+    { UINT64_C(0x2aac18030b01abab), UINT64_C(0x17624f8a762fd82b) }, { UINT64_C(0xbbbce0026f348956), UINT64_C(0x12b50c6ec4f31355) },
+    { UINT64_C(0x92c7ccd0b1eda889), UINT64_C(0x1dee7a4ad4b81eef) }, { UINT64_C(0xdbd30a408e57ba07), UINT64_C(0x17f1fb6f10934bf2) },
+    { UINT64_C(0x7ca8d50071dfc806), UINT64_C(0x1327fc58da0f6ff5) }, { UINT64_C(0xfaa7bb33e9660cd6), UINT64_C(0x1ea6608e29b24cbb) },
+    { UINT64_C(0x9552fc298784d711), UINT64_C(0x18851a0b548ea3c9) }, { UINT64_C(0xaaa8c9bad2d0ac0e), UINT64_C(0x139dae6f76d88307) },
+    { UINT64_C(0xdddadc5e1e1aace3), UINT64_C(0x1f62b0b257c0d1a5) }, { UINT64_C(0x7e48b04b4b488a4f), UINT64_C(0x191bc08eac9a4151) },
+    { UINT64_C(0xcb6d59d5d5d3a1d9), UINT64_C(0x141633a556e1cdda) }, { UINT64_C(0x3c577b1177dc817b), UINT64_C(0x1011c2eaabe7d7e2) },
+    { UINT64_C(0xc6f25e825960cf2a), UINT64_C(0x19b604aaaca62636) }, { UINT64_C(0x6bf518684780a5bb), UINT64_C(0x14919d5556eb51c5) },
+    { UINT64_C(0x232a79ed06008496), UINT64_C(0x10747ddddf22a7d1) }, { UINT64_C(0xd1dd8fe1a3340756), UINT64_C(0x1a53fc9631d10c81) },
+    { UINT64_C(0xa7e4731ae8f66c45), UINT64_C(0x150ffd44f4a73d34) }, { UINT64_C(0x531d28e253f8569e), UINT64_C(0x10d9976a5d52975d) },
+    { UINT64_C(0xeb61db03b98d5762), UINT64_C(0x1af5bf109550f22e) }, { UINT64_C(0xbc4e48cfc7a445e8), UINT64_C(0x159165a6ddda5b58) },
+    { UINT64_C(0x6371d3d96c836b20), UINT64_C(0x11411e1f17e1e2ad) }, { UINT64_C(0x9f1c8628ad9f11cd), UINT64_C(0x1b9b6364f3030448) },
+    { UINT64_C(0xe5b06b53be18db0b), UINT64_C(0x1615e91d8f359d06) }, { UINT64_C(0xeaf3890fcb4715a2), UINT64_C(0x11ab20e472914a6b) },
+    { UINT64_C(0x44b8db4c7871bc37), UINT64_C(0x1c45016d841baa46) }, { UINT64_C(0x03c715d6c6c1635f), UINT64_C(0x169d9abe03495505) },
+    { UINT64_C(0x3638de456bcde919), UINT64_C(0x1217aefe69077737) }, { UINT64_C(0x56c163a2461641c1), UINT64_C(0x1cf2b1970e725858) },
+    { UINT64_C(0xdf011c81d1ab67ce), UINT64_C(0x17288e1271f51379) }, { UINT64_C(0x7f3416ce4155eca5), UINT64_C(0x1286d80ec190dc61) },
+    { UINT64_C(0x6520247d3556476e), UINT64_C(0x1da48ce468e7c702) }, { UINT64_C(0xea801d30f7783925), UINT64_C(0x17b6d71d20b96c01) },
+    { UINT64_C(0xbb99b0f3f92cfa84), UINT64_C(0x12f8ac174d612334) }, { UINT64_C(0x5f5c4e532847f739), UINT64_C(0x1e5aacf215683854) },
+    { UINT64_C(0x7f7d0b75b9d32c2e), UINT64_C(0x18488a5b44536043) }, { UINT64_C(0x9930d5f7c7dc2358), UINT64_C(0x136d3b7c36a919cf) },
+    { UINT64_C(0x8eb4898c72f9d226), UINT64_C(0x1f152bf9f10e8fb2) }, { UINT64_C(0x722a07a38f2e41b8), UINT64_C(0x18ddbcc7f40ba628) },
+    { UINT64_C(0xc1bb394fa5be9afa), UINT64_C(0x13e497065cd61e86) }, { UINT64_C(0x9c5ec2190930f7f6), UINT64_C(0x1fd424d6faf030d7) },
+    { UINT64_C(0x49e56814075a5ff8), UINT64_C(0x197683df2f268d79) }, { UINT64_C(0x6e51201005e1e660), UINT64_C(0x145ecfe5bf520ac7) },
+    { UINT64_C(0xf1da800cd181851a), UINT64_C(0x104bd984990e6f05) }, { UINT64_C(0x4fc400148268d4f5), UINT64_C(0x1a12f5a0f4e3e4d6) },
+    { UINT64_C(0xd96999aa01ed772b), UINT64_C(0x14dbf7b3f71cb711) }, { UINT64_C(0xadee1488018ac5bc), UINT64_C(0x10aff95cc5b09274) },
+    { UINT64_C(0x497ceda668de092c), UINT64_C(0x1ab328946f80ea54) }, { UINT64_C(0x3aca57b853e4d424), UINT64_C(0x155c2076bf9a5510) },
+    { UINT64_C(0x623b7960431d7683), UINT64_C(0x1116805effaeaa73) }, { UINT64_C(0x9d2bf566d1c8bd9e), UINT64_C(0x1b5733cb32b110b8) },
+    { UINT64_C(0x7dbcc452416d647f), UINT64_C(0x15df5ca28ef40d60) }, { UINT64_C(0xcafd69db678ab6cc), UINT64_C(0x117f7d4ed8c33de6) },
+    { UINT64_C(0xab2f0fc572778adf), UINT64_C(0x1bff2ee48e052fd7) }, { UINT64_C(0x88f273045b92d580), UINT64_C(0x1665bf1d3e6a8cac) },
+    { UINT64_C(0xd3f528d049424466), UINT64_C(0x11eaff4a98553d56) }, { UINT64_C(0xb988414d4203a0a3), UINT64_C(0x1cab3210f3bb9557) },
+    { UINT64_C(0x6139cdd76802e6e9), UINT64_C(0x16ef5b40c2fc7779) }, { UINT64_C(0xe761717920025254), UINT64_C(0x125915cd68c9f92d) },
+    { UINT64_C(0xa568b58e999d5086), UINT64_C(0x1d5b561574765b7c) }, { UINT64_C(0x5120913ee14aa6d2), UINT64_C(0x177c44ddf6c515fd) },
+    { UINT64_C(0xa74d40ff1aa21f0e), UINT64_C(0x12c9d0b1923744ca) }, { UINT64_C(0x0baece64f769cb4a), UINT64_C(0x1e0fb44f50586e11) },
+    { UINT64_C(0x3c8bd850c5ee3c3b), UINT64_C(0x180c903f7379f1a7) }, { UINT64_C(0xca0979da37f1c9c9), UINT64_C(0x133d4032c2c7f485) },
+    { UINT64_C(0xa9a8c2f6bfe942db), UINT64_C(0x1ec866b79e0cba6f) }, { UINT64_C(0x2153cf2bccba9be3), UINT64_C(0x18a0522c7e709526) },
+    { UINT64_C(0x1aa9728970954982), UINT64_C(0x13b374f06526ddb8) }, { UINT64_C(0xf775840f1a88759d), UINT64_C(0x1f8587e7083e2f8c) },
+    { UINT64_C(0x5f9136727ba05e17), UINT64_C(0x19379fec0698260a) }, { UINT64_C(0x1940f85b9619e4df), UINT64_C(0x142c7ff0054684d5) },
+    { UINT64_C(0xe100c6afab47ea4c), UINT64_C(0x1023998cd1053710) }, { UINT64_C(0xce67a44c453fdd47), UINT64_C(0x19d28f47b4d524e7) },
+    { UINT64_C(0xd852e9d69dccb106), UINT64_C(0x14a8729fc3ddb71f) }, { UINT64_C(0x79dbee454b0a2738), UINT64_C(0x1086c219697e2c19) },
+    { UINT64_C(0x295fe3a211a9d859), UINT64_C(0x1a71368f0f30468f) }, { UINT64_C(0xbab31c81a7bb137a), UINT64_C(0x15275ed8d8f36ba5) },
+    { UINT64_C(0x6228e39aec95a92f), UINT64_C(0x10ec4be0ad8f8951) }, { UINT64_C(0x9d0e38f7e0ef7517), UINT64_C(0x1b13ac9aaf4c0ee8) },
+    { UINT64_C(0xb0d82d931a592a79), UINT64_C(0x15a956e225d67253) }, { UINT64_C(0x8d79be0f4847552e), UINT64_C(0x11544581b7dec1dc) },
+    { UINT64_C(0x158f967eda0bbb7c), UINT64_C(0x1bba08cf8c979c94) }, { UINT64_C(0x77a611ff14d62f97), UINT64_C(0x162e6d72d6dfb076) },
+    { UINT64_C(0xf951a7ff43de8c79), UINT64_C(0x11bebdf578b2f391) }, { UINT64_C(0xc21c3ffed2fdad8e), UINT64_C(0x1c6463225ab7ec1c) },
+    { UINT64_C(0x01b0333242648ad8), UINT64_C(0x16b6b5b5155ff017) }, { UINT64_C(0x0159c28e9b83a246), UINT64_C(0x122bc490dde659ac) },
+    { UINT64_C(0xcef604175f3903a3), UINT64_C(0x1d12d41afca3c2ac) }, { UINT64_C(0x725e69ac4c2d9c83), UINT64_C(0x17424348ca1c9bbd) },
+    { UINT64_C(0xf5185489d68ae39c), UINT64_C(0x129b69070816e2fd) }, { UINT64_C(0xee8d540fbdab05c6), UINT64_C(0x1dc574d80cf16b2f) },
+    { UINT64_C(0xbed77672fe226b05), UINT64_C(0x17d12a4670c1228c) }, { UINT64_C(0xff12c528cb4ebc04), UINT64_C(0x130dbb6b8d674ed6) },
+    { UINT64_C(0xcb513b74787df9a0), UINT64_C(0x1e7c5f127bd87e24) }, { UINT64_C(0x090dc929f9fe614d), UINT64_C(0x18637f41fcad31b7) },
+    { UINT64_C(0xa0d7d42194cb810a), UINT64_C(0x1382cc34ca2427c5) }, { UINT64_C(0x67bfb9cf5478ce77), UINT64_C(0x1f37ad21436d0c6f) },
+    { UINT64_C(0x1fcc94a5dd2d71f9), UINT64_C(0x18f9574dcf8a7059) }, { UINT64_C(0x7fd6dd517dbdf4c7), UINT64_C(0x13faac3e3fa1f37a) },
+    { UINT64_C(0xffbe2ee8c92fee0b), UINT64_C(0x1ff779fd329cb8c3) }, { UINT64_C(0x6631bf20a0f324d6), UINT64_C(0x1992c7fdc216fa36) },
+    { UINT64_C(0xb827cc1a1a5c1d78), UINT64_C(0x14756ccb01abfb5e) }, { UINT64_C(0x935309ae7b7ce460), UINT64_C(0x105df0a267bcc918) },
+    { UINT64_C(0x1eeb42b0c594a099), UINT64_C(0x1a2fe76a3f9474f4) }, { UINT64_C(0xe58902270476e6e1), UINT64_C(0x14f31f8832dd2a5c) },
+    { UINT64_C(0xb7a0ce859d2bebe7), UINT64_C(0x10c27fa028b0eeb0) }, { UINT64_C(0x59014a6f61dfdfd8), UINT64_C(0x1ad0cc33744e4ab4) },
+    { UINT64_C(0xe0cdd525e7e64cad), UINT64_C(0x1573d68f903ea229) }, { UINT64_C(0x4d7177518651d6f1), UINT64_C(0x11297872d9cbb4ee) },
+    { UINT64_C(0x7be8bee8d6e957e8), UINT64_C(0x1b758d848fac54b0) }, { UINT64_C(0xfcba3253df211320), UINT64_C(0x15f7a46a0c89dd59) },
+    { UINT64_C(0x63c8284318e74280), UINT64_C(0x1192e9ee706e4aae) }, { UINT64_C(0x060d0d3827d86a66), UINT64_C(0x1c1e43171a4a1117) },
+    { UINT64_C(0x6b3da42cecad21eb), UINT64_C(0x167e9c127b6e7412) }, { UINT64_C(0x88fe1cf0bd574e56), UINT64_C(0x11fee341fc585cdb) },
+    { UINT64_C(0x419694b462254a23), UINT64_C(0x1ccb0536608d615f) }, { UINT64_C(0x67abaa29e81dd4e9), UINT64_C(0x1708d0f84d3de77f) },
+    { UINT64_C(0xb95621bb2017dd87), UINT64_C(0x126d73f9d764b932) }, { UINT64_C(0xc223692b668c95a5), UINT64_C(0x1d7becc2f23ac1ea) },
+    { UINT64_C(0xce82ba891ed6de1d), UINT64_C(0x179657025b6234bb) }, { UINT64_C(0xa53562074bdf1818), UINT64_C(0x12deac01e2b4f6fc) },
+    { UINT64_C(0x3b889cd87964f359), UINT64_C(0x1e3113363787f194) }, { UINT64_C(0xfc6d4a46c783f5e1), UINT64_C(0x18274291c6065adc) },
+    { UINT64_C(0x30576e9f06032b1a), UINT64_C(0x13529ba7d19eaf17) }, { UINT64_C(0x1a257dcb3cd1de90), UINT64_C(0x1eea92a61c311825) },
+    { UINT64_C(0x481dfe3c30a7e540), UINT64_C(0x18bba884e35a79b7) }, { UINT64_C(0xd34b31c9c0865100), UINT64_C(0x13c9539d82aec7c5) },
+    { UINT64_C(0x5211e942cda3b4cd), UINT64_C(0x1fa885c8d117a609) }, { UINT64_C(0x74db21023e1c90a4), UINT64_C(0x19539e3a40dfb807) },
+    { UINT64_C(0xf715b401cb4a0d50), UINT64_C(0x1442e4fb67196005) }, { UINT64_C(0xf8de299b09080aa7), UINT64_C(0x103583fc527ab337) },
+    { UINT64_C(0x8e304291a80cddd7), UINT64_C(0x19ef3993b72ab859) }, { UINT64_C(0x3e8d020e200a4b13), UINT64_C(0x14bf6142f8eef9e1) },
+    { UINT64_C(0x653d9b3e80083c0f), UINT64_C(0x10991a9bfa58c7e7) }, { UINT64_C(0x6ec8f864000d2ce4), UINT64_C(0x1a8e90f9908e0ca5) },
+    { UINT64_C(0x8bd3f9e999a423ea), UINT64_C(0x153eda614071a3b7) }, { UINT64_C(0x3ca994bae1501cbb), UINT64_C(0x10ff151a99f482f9) },
+    { UINT64_C(0xc775bac49bb3612b), UINT64_C(0x1b31bb5dc320d18e) }, { UINT64_C(0xd2c4956a16291a89), UINT64_C(0x15c162b168e70e0b) },
+    { UINT64_C(0xdbd0778811ba7ba1), UINT64_C(0x11678227871f3e6f) }, { UINT64_C(0x2c80bf401c5d929b), UINT64_C(0x1bd8d03f3e9863e6) },
+    { UINT64_C(0xbd33cc3349e47549), UINT64_C(0x16470cff6546b651) }, { UINT64_C(0xca8fd68f6e505dd4), UINT64_C(0x11d270cc51055ea7) },
+    { UINT64_C(0x4419574be3b3c953), UINT64_C(0x1c83e7ad4e6efdd9) }, { UINT64_C(0x0347790982f63aa9), UINT64_C(0x16cfec8aa52597e1) },
+    { UINT64_C(0xcf6c60d468c4fbba), UINT64_C(0x123ff06eea847980) }, { UINT64_C(0xe57a34870e07f92a), UINT64_C(0x1d331a4b10d3f59a) },
+    { UINT64_C(0x512e906c0b399422), UINT64_C(0x175c1508da432ae2) }, { UINT64_C(0xda8ba6bcd5c7a9b5), UINT64_C(0x12b010d3e1cf5581) },
+    { UINT64_C(0x90df712e22d90f87), UINT64_C(0x1de6815302e5559c) }, { UINT64_C(0xda4c5a8b4f140c6c), UINT64_C(0x17eb9aa8cf1dde16) },
+    { UINT64_C(0xaea37ba2a5a9a38a), UINT64_C(0x1322e220a5b17e78) }, { UINT64_C(0x7dd25f6aa2a905a9), UINT64_C(0x1e9e369aa2b59727) },
+    { UINT64_C(0x97db7f888220d154), UINT64_C(0x187e92154ef7ac1f) }, { UINT64_C(0x797c6606ce80a777), UINT64_C(0x139874ddd8c6234c) },
+    { UINT64_C(0x8f2d700ae4010bf1), UINT64_C(0x1f5a549627a36bad) }, { UINT64_C(0x0c2459a25000d65a), UINT64_C(0x191510781fb5efbe) },
+    { UINT64_C(0x701d1481d99a4515), UINT64_C(0x1410d9f9b2f7f2fe) }, { UINT64_C(0xc017439b147b6a77), UINT64_C(0x100d7b2e28c65bfe) },
+    { UINT64_C(0xccf205c4ed9243f2), UINT64_C(0x19af2b7d0e0a2cca) }, { UINT64_C(0x0a5b37d0be0e9cc2), UINT64_C(0x148c22ca71a1bd6f) },
+    { UINT64_C(0x0848f973cb3ee3ce), UINT64_C(0x10701bd527b4978c) }, { UINT64_C(0xda0e5bec78649fb0), UINT64_C(0x1a4cf9550c5425ac) },
+    { UINT64_C(0x7b3eaff060507fc0), UINT64_C(0x150a6110d6a9b7bd) }, { UINT64_C(0x95cbbff380406633), UINT64_C(0x10d51a73deee2c97) },
+    { UINT64_C(0xefac665266cd7052), UINT64_C(0x1aee90b964b04758) }, { UINT64_C(0x2623850eb8a459db), UINT64_C(0x158ba6fab6f36c47) },
+    { UINT64_C(0x1e82d0d893b6ae49), UINT64_C(0x113c85955f29236c) }, { UINT64_C(0xfd9e1af41f8ab075), UINT64_C(0x1b9408eefea838ac) },
+    { UINT64_C(0x97b1af29b2d559f7), UINT64_C(0x16100725988693bd) }, { UINT64_C(0xac8e25baf5777b2c), UINT64_C(0x11a66c1e139edc97) },
+    { UINT64_C(0x7a7d092b2258c513), UINT64_C(0x1c3d79c9b8fe2dbf) }, { UINT64_C(0x61fda0ef4ead6a76), UINT64_C(0x169794a160cb57cc) },
+    { UINT64_C(0xe7fe1a590bbdeec5), UINT64_C(0x1212dd4de7091309) }, { UINT64_C(0xa6635d5b45fcb13a), UINT64_C(0x1ceafbafd80e84dc) },
+    { UINT64_C(0x851c4aaf6b308dc8), UINT64_C(0x172262f3133ed0b0) }, { UINT64_C(0xd0e36ef2bc26d7d4), UINT64_C(0x1281e8c275cbda26) },
+    { UINT64_C(0xb49f17eac6a48c86), UINT64_C(0x1d9ca79d894629d7) }, { UINT64_C(0x2a18dfef0550706b), UINT64_C(0x17b08617a104ee46) },
+    { UINT64_C(0x54e0b3259dd9f389), UINT64_C(0x12f39e794d9d8b6b) }, { UINT64_C(0x87cdeb6f62f65274), UINT64_C(0x1e5297287c2f4578) },
+    { UINT64_C(0xd30b22bf825ea85d), UINT64_C(0x18421286c9bf6ac6) }, { UINT64_C(0x0f3c1bcc684bb9e4), UINT64_C(0x13680ed23aff889f) },
+    { UINT64_C(0x18602c7a4079296d), UINT64_C(0x1f0ce4839198da98) }, { UINT64_C(0x46b356c833942124), UINT64_C(0x18d71d360e13e213) },
+    { UINT64_C(0x388f78a029434db6), UINT64_C(0x13df4a91a4dcb4dc) }, { UINT64_C(0x5a7f2766a86baf8a), UINT64_C(0x1fcbaa82a1612160) },
+    { UINT64_C(0x153285ebb9efbfa2), UINT64_C(0x196fbb9bb44db44d) }, { UINT64_C(0xaa8ed189618c994e), UINT64_C(0x145962e2f6a4903d) },
+    { UINT64_C(0xeed8a7a11ad6e10c), UINT64_C(0x1047824f2bb6d9ca) }, { UINT64_C(0x7e27729b5e249b45), UINT64_C(0x1a0c03b1df8af611) },
+    { UINT64_C(0xfe85f549181d4904), UINT64_C(0x14d6695b193bf80d) }, { UINT64_C(0xcb9e5dd4134aa0d0), UINT64_C(0x10ab877c142ff9a4) },
+    { UINT64_C(0xdf63c9535211014d), UINT64_C(0x1aac0bf9b9e65c3a) }, { UINT64_C(0x191ca10f74da6771), UINT64_C(0x15566ffafb1eb02f) },
+    { UINT64_C(0xadb080d92a4852c1), UINT64_C(0x1111f32f2f4bc025) }, { UINT64_C(0x15e7348eaa0d5134), UINT64_C(0x1b4feb7eb212cd09) },
+    { UINT64_C(0xab1f5d3eee710dc4), UINT64_C(0x15d98932280f0a6d) }, { UINT64_C(0xbc1917658b8da49d), UINT64_C(0x117ad428200c0857) },
+    { UINT64_C(0x2cf4f23c127c3a94), UINT64_C(0x1bf7b9d9cce00d59) }, { UINT64_C(0xf0c3f4fcdb969543), UINT64_C(0x165fc7e170b33de0) },
+    { UINT64_C(0x5a365d9716121103), UINT64_C(0x11e6398126f5cb1a) }, { UINT64_C(0x9056fc24f01ce804), UINT64_C(0x1ca38f350b22de90) },
+    { UINT64_C(0xd9df301d8ce3ecd0), UINT64_C(0x16e93f5da2824ba6) }, { UINT64_C(0xe17f59b13d8323da), UINT64_C(0x125432b14ecea2eb) },
+    { UINT64_C(0x68cbc2b52f38395c), UINT64_C(0x1d53844ee47dd179) }, { UINT64_C(0x53d6355dbf602de3), UINT64_C(0x177603725064a794) },
+    { UINT64_C(0xa9782ab165e68b1c), UINT64_C(0x12c4cf8ea6b6ec76) }, { UINT64_C(0x0f26aab56fd744fa), UINT64_C(0x1e07b27dd78b13f1) },
+    { UINT64_C(0x3f52222abfdf6a62), UINT64_C(0x18062864ac6f4327) }, { UINT64_C(0x65db4e88997f884e), UINT64_C(0x1338205089f29c1f) },
+    { UINT64_C(0x6fc54a7428cc0d4a), UINT64_C(0x1ec033b40fea9365) }, { UINT64_C(0x596aa1f68709a43b), UINT64_C(0x1899c2f673220f84) },
+    { UINT64_C(0xadeee7f86c07b696), UINT64_C(0x13ae3591f5b4d936) }, { UINT64_C(0x497e3ff3e00c5756), UINT64_C(0x1f7d228322baf524) },
+    { UINT64_C(0xd464fff64cd6ac45), UINT64_C(0x1930e868e89590e9) }, { UINT64_C(0x4383fff83d7889d1), UINT64_C(0x14272053ed4473ee) },
+    { UINT64_C(0xcf9cccc69793a174), UINT64_C(0x101f4d0ff1038ff1) }, { UINT64_C(0x7f6147a425b90252), UINT64_C(0x19cbae7fe805b31c) },
+    { UINT64_C(0xcc4dd2e9b7c7350f), UINT64_C(0x14a2f1ffecd15c16) }, { UINT64_C(0x3d0b0f215fd290d9), UINT64_C(0x10825b3323dab012) },
+    { UINT64_C(0x61ab4b689950e7c1), UINT64_C(0x1a6a2b85062ab350) }, { UINT64_C(0x4e22a2ba1440b967), UINT64_C(0x1521bc6a6b555c40) },
+    { UINT64_C(0x0b4ee894dd009453), UINT64_C(0x10e7c9eebc4449cd) }, { UINT64_C(0x1217da87c800ed51), UINT64_C(0x1b0c764ac6d3a948) },
+    { UINT64_C(0xdb46486ca000bdda), UINT64_C(0x15a391d56bdc876c) }, { UINT64_C(0x490506bd4ccd64af), UINT64_C(0x114fa7ddefe39f8a) },
+    { UINT64_C(0xa8080ac87ae23ab1), UINT64_C(0x1bb2a62fe638ff43) }, { UINT64_C(0x5339a239fbe82ef4), UINT64_C(0x162884f31e93ff69) },
+    { UINT64_C(0x75c7b4fb2fecf25d), UINT64_C(0x11ba03f5b20fff87) }, { UINT64_C(0x22d92191e647ea2e), UINT64_C(0x1c5cd322b67fff3f) },
+    { UINT64_C(0xb57a8141850654f2), UINT64_C(0x16b0a8e891ffff65) }, { UINT64_C(0xc4620101373843f5), UINT64_C(0x1226ed86db3332b7) },
+    { UINT64_C(0x3a366801f1f39fee), UINT64_C(0x1d0b15a491eb8459) }, { UINT64_C(0xfb5eb99b27f6198b), UINT64_C(0x173c115074bc69e0) },
+    { UINT64_C(0x2f7efae2865e7ad6), UINT64_C(0x129674405d6387e7) }, { UINT64_C(0xe597f7d0d6fd9156), UINT64_C(0x1dbd86cd6238d971) },
+    { UINT64_C(0x8479930d78cadaab), UINT64_C(0x17cad23de82d7ac1) }, { UINT64_C(0xd06142712d6f1556), UINT64_C(0x1308a831868ac89a) },
+    { UINT64_C(0x4d686a4eaf182222), UINT64_C(0x1e74404f3daada91) }, { UINT64_C(0xa453883ef279b4e8), UINT64_C(0x185d003f6488aeda) },
+    { UINT64_C(0xe9dc6cff28615d87), UINT64_C(0x137d99cc506d58ae) }, { UINT64_C(0xa960ae650d6895a4), UINT64_C(0x1f2f5c7a1a488de4) },
+    { UINT64_C(0xbab3beb73ded4483), UINT64_C(0x18f2b061aea07183) }, { UINT64_C(0x2ef6322c318a9d36), UINT64_C(0x13f559e7bee6c136) },
+    { UINT64_C(0xe4bd1d13827761f0), UINT64_C(0x1feef63f97d79b89) }, { UINT64_C(0x83ca7da9352c4e5a), UINT64_C(0x198bf832dfdfafa1) },
+    { UINT64_C(0x9ca1fe20f756a515), UINT64_C(0x146ff9c24cb2f2e7) }, { UINT64_C(0x4a1b31b3f9121daa), UINT64_C(0x1059949b708f28b9) },
+    { UINT64_C(0x435eb5ecc1b695dd), UINT64_C(0x1a28edc580e50df5) }, { UINT64_C(0x35e55e57015ede4a), UINT64_C(0x14ed8b04671da4c4) },
+    { UINT64_C(0xc4b77eac0118b1d5), UINT64_C(0x10be08d0527e1d69) }, { UINT64_C(0xa12597799b5ab622), UINT64_C(0x1ac9a7b3b7302f0f) },
+    { UINT64_C(0x4db7ac6149155e81), UINT64_C(0x156e1fc2f8f358d9) }, { UINT64_C(0xd7c6238107444b9b), UINT64_C(0x1124e63593f5e0ad) },
+    { UINT64_C(0x593d059b3ed3ac2b), UINT64_C(0x1b6e3d2286563449) }, { UINT64_C(0xe0fd9e15cbdc89bc), UINT64_C(0x15f1ca820511c36d) },
+    { UINT64_C(0xb3fe18116fe3a163), UINT64_C(0x118e3b9b37416924) }, { UINT64_C(0x866359b57fd29bd1), UINT64_C(0x1c16c5c525357507) },
+    { UINT64_C(0xd1e91491330ee30e), UINT64_C(0x16789e3750f790d2) }, { UINT64_C(0x74ba76da8f3f1c0b), UINT64_C(0x11fa182c40c60d75) },
+    { UINT64_C(0xedf72490e531c678), UINT64_C(0x1cc359e067a348bb) }, { UINT64_C(0x8b2c1d40b75b052d), UINT64_C(0x1702ae4d1fb5d3c9) },
+    { UINT64_C(0x6f567dcd5f7c0424), UINT64_C(0x12688b70e62b0fd4) }, { UINT64_C(0x7ef0c94898c66d06), UINT64_C(0x1d74124e3d11b2ed) },
+    { UINT64_C(0x98c0a106e09ebd9f), UINT64_C(0x17900ea4fda7c257) }, { UINT64_C(0x470080d24d4bcae6), UINT64_C(0x12d9a550caec9b79) },
+    { UINT64_C(0xd800ce1d487944a2), UINT64_C(0x1e29088144adc58e) }, { UINT64_C(0x1333d8176d2dd082), UINT64_C(0x1820d39a9d57d13f) },
+    { UINT64_C(0xa8f646792424a6ce), UINT64_C(0x134d76154aaca765) }, { UINT64_C(0x74bd3d8ea03aa47d), UINT64_C(0x1ee25688777aa56f) },
+    { UINT64_C(0x5d64313ee6955064), UINT64_C(0x18b51206c5fbb78c) }, { UINT64_C(0x4ab68dcbebaaa6b7), UINT64_C(0x13c40e6bd1962c70) },
+    { UINT64_C(0x1124161312aaa457), UINT64_C(0x1fa01712e8f0471a) }, { UINT64_C(0xda8344dc0eeee9df), UINT64_C(0x194cdf4253f36c14) },
+    { UINT64_C(0xe2029d7cd8bf2180), UINT64_C(0x143d7f6843292343) }, { UINT64_C(0x4e687dfd7a328133), UINT64_C(0x103132b9cf541c36) },
+    { UINT64_C(0x4a40c9959050ceb8), UINT64_C(0x19e851294bb9c6bd) }, { UINT64_C(0x0833d477a6a70bc6), UINT64_C(0x14b9da876fc7d231) },
+    { UINT64_C(0xa02976c61eec096b), UINT64_C(0x1094aed2bfd30e8d) }, { UINT64_C(0x004257a364acdbdf), UINT64_C(0x1a877e1dffb81749) },
+    { UINT64_C(0xcd01dfb5ea23e319), UINT64_C(0x153931b1996012a0) }, { UINT64_C(0x70ce4c91881cb5ae), UINT64_C(0x10fa8e27ade6754d) },
+    { UINT64_C(0x1ae3adb5a69455e2), UINT64_C(0x1b2a7d0c4970bbaf) }, { UINT64_C(0x7be957c4854377e8), UINT64_C(0x15bb973d078d62f2) },
+    { UINT64_C(0xc987796a0435f987), UINT64_C(0x1162df64060ab58e) }, { UINT64_C(0x75a58f1006bcc271), UINT64_C(0x1bd1656cd67788e4) },
+    { UINT64_C(0xf7b7a5a66bca3527), UINT64_C(0x16411df0ab92d3e9) }, { UINT64_C(0x5fc61e1ebca1c41f), UINT64_C(0x11cdb18d560f0fee) },
+    { UINT64_C(0xffa363646102d365), UINT64_C(0x1c7c4f4889b1b316) }, { UINT64_C(0x32e91c504d9bdc51), UINT64_C(0x16c9d906d48e28df) },
+    { UINT64_C(0x8f20e37371497d0e), UINT64_C(0x123b140576d820b2) }, { UINT64_C(0x7e9b0585820f2e7c), UINT64_C(0x1d2b533bf159cdea) },
+    { UINT64_C(0xcbaf379e01a5beca), UINT64_C(0x1755dc2ff447d7ee) }, { UINT64_C(0x0958f94b348498a1), UINT64_C(0x12ab168cc36cacbf) }
+};
 
-typedef struct printf_floating_point_zero_pure_data {
-    size_t pure_width;
-} printf_floating_point_zero_pure_data_t;
+static const uint64_t fp64_shortest_pow5_split[FP64_SHORTEST_POW5_TABLE_SIZE][2] = {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1000000000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1400000000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1900000000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1f40000000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1388000000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x186a000000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1e84800000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1312d00000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x17d7840000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1dcd650000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x12a05f2000000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x174876e800000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1d1a94a200000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x12309ce540000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x16bcc41e90000000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1c6bf52634000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x11c37937e0800000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x16345785d8a00000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1bc16d674ec80000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1158e460913d0000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x15af1d78b58c4000) }, { UINT64_C(0x0000000000000000), UINT64_C(0x1b1ae4d6e2ef5000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x10f0cf064dd59200) }, { UINT64_C(0x0000000000000000), UINT64_C(0x152d02c7e14af680) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1a784379d99db420) }, { UINT64_C(0x0000000000000000), UINT64_C(0x108b2a2c28029094) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x14adf4b7320334b9) }, { UINT64_C(0x4000000000000000), UINT64_C(0x19d971e4fe8401e7) },
+    { UINT64_C(0x8800000000000000), UINT64_C(0x1027e72f1f128130) }, { UINT64_C(0xaa00000000000000), UINT64_C(0x1431e0fae6d7217c) },
+    { UINT64_C(0xd480000000000000), UINT64_C(0x193e5939a08ce9db) }, { UINT64_C(0xc9a0000000000000), UINT64_C(0x1f8def8808b02452) },
+    { UINT64_C(0xbe04000000000000), UINT64_C(0x13b8b5b5056e16b3) }, { UINT64_C(0xad85000000000000), UINT64_C(0x18a6e32246c99c60) },
+    { UINT64_C(0xd8e6400000000000), UINT64_C(0x1ed09bead87c0378) }, { UINT64_C(0x878fe80000000000), UINT64_C(0x13426172c74d822b) },
+    { UINT64_C(0x6973e20000000000), UINT64_C(0x1812f9cf7920e2b6) }, { UINT64_C(0x03d0da8000000000), UINT64_C(0x1e17b84357691b64) },
+    { UINT64_C(0x8262889000000000), UINT64_C(0x12ced32a16a1b11e) }, { UINT64_C(0x22fb2ab400000000), UINT64_C(0x178287f49c4a1d66) },
+    { UINT64_C(0xabb9f56100000000), UINT64_C(0x1d6329f1c35ca4bf) }, { UINT64_C(0xcb54395ca0000000), UINT64_C(0x125dfa371a19e6f7) },
+    { UINT64_C(0xbe2947b3c8000000), UINT64_C(0x16f578c4e0a060b5) }, { UINT64_C(0x2db399a0ba000000), UINT64_C(0x1cb2d6f618c878e3) },
+    { UINT64_C(0xfc90400474400000), UINT64_C(0x11efc659cf7d4b8d) }, { UINT64_C(0x7bb4500591500000), UINT64_C(0x166bb7f0435c9e71) },
+    { UINT64_C(0xdaa16406f5a40000), UINT64_C(0x1c06a5ec5433c60d) }, { UINT64_C(0xa8a4de8459868000), UINT64_C(0x118427b3b4a05bc8) },
+    { UINT64_C(0xd2ce16256fe82000), UINT64_C(0x15e531a0a1c872ba) }, { UINT64_C(0x87819baecbe22800), UINT64_C(0x1b5e7e08ca3a8f69) },
+    { UINT64_C(0xf4b1014d3f6d5900), UINT64_C(0x111b0ec57e6499a1) }, { UINT64_C(0x71dd41a08f48af40), UINT64_C(0x1561d276ddfdc00a) },
+    { UINT64_C(0x0e549208b31adb10), UINT64_C(0x1aba4714957d300d) }, { UINT64_C(0x28f4db456ff0c8ea), UINT64_C(0x10b46c6cdd6e3e08) },
+    { UINT64_C(0x33321216cbecfb24), UINT64_C(0x14e1878814c9cd8a) }, { UINT64_C(0xbffe969c7ee839ed), UINT64_C(0x1a19e96a19fc40ec) },
+    { UINT64_C(0xf7ff1e21cf512434), UINT64_C(0x105031e2503da893) }, { UINT64_C(0xf5fee5aa43256d41), UINT64_C(0x14643e5ae44d12b8) },
+    { UINT64_C(0x337e9f14d3eec892), UINT64_C(0x197d4df19d605767) }, { UINT64_C(0x005e46da08ea7ab6), UINT64_C(0x1fdca16e04b86d41) },
+    { UINT64_C(0xa03aec4845928cb2), UINT64_C(0x13e9e4e4c2f34448) }, { UINT64_C(0xc849a75a56f72fde), UINT64_C(0x18e45e1df3b0155a) },
+    { UINT64_C(0x7a5c1130ecb4fbd6), UINT64_C(0x1f1d75a5709c1ab1) }, { UINT64_C(0xec798abe93f11d65), UINT64_C(0x13726987666190ae) },
+    { UINT64_C(0xa797ed6e38ed64bf), UINT64_C(0x184f03e93ff9f4da) }, { UINT64_C(0x517de8c9c728bdef), UINT64_C(0x1e62c4e38ff87211) },
+    { UINT64_C(0xd2eeb17e1c7976b5), UINT64_C(0x12fdbb0e39fb474a) }, { UINT64_C(0x87aa5ddda397d462), UINT64_C(0x17bd29d1c87a191d) },
+    { UINT64_C(0xe994f5550c7dc97b), UINT64_C(0x1dac74463a989f64) }, { UINT64_C(0x11fd195527ce9ded), UINT64_C(0x128bc8abe49f639f) },
+    { UINT64_C(0xd67c5faa71c24568), UINT64_C(0x172ebad6ddc73c86) }, { UINT64_C(0x8c1b77950e32d6c2), UINT64_C(0x1cfa698c95390ba8) },
+    { UINT64_C(0x57912abd28dfc639), UINT64_C(0x121c81f7dd43a749) }, { UINT64_C(0xad75756c7317b7c8), UINT64_C(0x16a3a275d494911b) },
+    { UINT64_C(0x98d2d2c78fdda5ba), UINT64_C(0x1c4c8b1349b9b562) }, { UINT64_C(0x9f83c3bcb9ea8794), UINT64_C(0x11afd6ec0e14115d) },
+    { UINT64_C(0x0764b4abe8652979), UINT64_C(0x161bcca7119915b5) }, { UINT64_C(0x493de1d6e27e73d7), UINT64_C(0x1ba2bfd0d5ff5b22) },
+    { UINT64_C(0x6dc6ad264d8f0866), UINT64_C(0x1145b7e285bf98f5) }, { UINT64_C(0xc938586fe0f2ca80), UINT64_C(0x159725db272f7f32) },
+    { UINT64_C(0x7b866e8bd92f7d20), UINT64_C(0x1afcef51f0fb5eff) }, { UINT64_C(0xad34051767bdae34), UINT64_C(0x10de1593369d1b5f) },
+    { UINT64_C(0x9881065d41ad19c1), UINT64_C(0x15159af804446237) }, { UINT64_C(0x7ea147f492186032), UINT64_C(0x1a5b01b605557ac5) },
+    { UINT64_C(0x6f24ccf8db4f3c1f), UINT64_C(0x1078e111c3556cbb) }, { UINT64_C(0x4aee003712230b27), UINT64_C(0x14971956342ac7ea) },
+    { UINT64_C(0xdda98044d6abcdf0), UINT64_C(0x19bcdfabc13579e4) }, { UINT64_C(0x0a89f02b062b60b6), UINT64_C(0x10160bcb58c16c2f) },
+    { UINT64_C(0xcd2c6c35c7b638e4), UINT64_C(0x141b8ebe2ef1c73a) }, { UINT64_C(0x8077874339a3c71d), UINT64_C(0x1922726dbaae3909) },
+    { UINT64_C(0xe0956914080cb8e4), UINT64_C(0x1f6b0f092959c74b) }, { UINT64_C(0x6c5d61ac8507f38e), UINT64_C(0x13a2e965b9d81c8f) },
+    { UINT64_C(0x4774ba17a649f072), UINT64_C(0x188ba3bf284e23b3) }, { UINT64_C(0x1951e89d8fdc6c8f), UINT64_C(0x1eae8caef261aca0) },
+    { UINT64_C(0x0fd3316279e9c3d9), UINT64_C(0x132d17ed577d0be4) }, { UINT64_C(0x13c7fdbb186434cf), UINT64_C(0x17f85de8ad5c4edd) },
+    { UINT64_C(0x58b9fd29de7d4203), UINT64_C(0x1df67562d8b36294) }, { UINT64_C(0xb7743e3a2b0e4942), UINT64_C(0x12ba095dc7701d9c) },
+    { UINT64_C(0xe5514dc8b5d1db92), UINT64_C(0x17688bb5394c2503) }, { UINT64_C(0xdea5a13ae3465277), UINT64_C(0x1d42aea2879f2e44) },
+    { UINT64_C(0x0b2784c4ce0bf38a), UINT64_C(0x1249ad2594c37ceb) }, { UINT64_C(0xcdf165f6018ef06d), UINT64_C(0x16dc186ef9f45c25) },
+    { UINT64_C(0x416dbf7381f2ac88), UINT64_C(0x1c931e8ab871732f) }, { UINT64_C(0x88e497a83137abd5), UINT64_C(0x11dbf316b346e7fd) },
+    { UINT64_C(0xeb1dbd923d8596ca), UINT64_C(0x1652efdc6018a1fc) }, { UINT64_C(0x25e52cf6cce6fc7d), UINT64_C(0x1be7abd3781eca7c) },
+    { UINT64_C(0x97af3c1a40105dce), UINT64_C(0x1170cb642b133e8d) }, { UINT64_C(0xfd9b0b20d0147542), UINT64_C(0x15ccfe3d35d80e30) },
+    { UINT64_C(0x3d01cde904199292), UINT64_C(0x1b403dcc834e11bd) }, { UINT64_C(0x462120b1a28ffb9b), UINT64_C(0x1108269fd210cb16) },
+    { UINT64_C(0xd7a968de0b33fa82), UINT64_C(0x154a3047c694fddb) }, { UINT64_C(0xcd93c3158e00f923), UINT64_C(0x1a9cbc59b83a3d52) },
+    { UINT64_C(0xc07c59ed78c09bb6), UINT64_C(0x10a1f5b813246653) }, { UINT64_C(0xb09b7068d6f0c2a3), UINT64_C(0x14ca732617ed7fe8) },
+    { UINT64_C(0xdcc24c830cacf34c), UINT64_C(0x19fd0fef9de8dfe2) }, { UINT64_C(0xc9f96fd1e7ec180f), UINT64_C(0x103e29f5c2b18bed) },
+    { UINT64_C(0x3c77cbc661e71e13), UINT64_C(0x144db473335deee9) }, { UINT64_C(0x8b95beb7fa60e598), UINT64_C(0x1961219000356aa3) },
+    { UINT64_C(0x6e7b2e65f8f91efe), UINT64_C(0x1fb969f40042c54c) }, { UINT64_C(0xc50cfcffbb9bb35f), UINT64_C(0x13d3e2388029bb4f) },
+    { UINT64_C(0xb6503c3faa82a037), UINT64_C(0x18c8dac6a0342a23) }, { UINT64_C(0xa3e44b4f95234844), UINT64_C(0x1efb1178484134ac) },
+    { UINT64_C(0xe66eaf11bd360d2b), UINT64_C(0x135ceaeb2d28c0eb) }, { UINT64_C(0xe00a5ad62c839075), UINT64_C(0x183425a5f872f126) },
+    { UINT64_C(0x980cf18bb7a47493), UINT64_C(0x1e412f0f768fad70) }, { UINT64_C(0x5f0816f752c6c8dc), UINT64_C(0x12e8bd69aa19cc66) },
+    { UINT64_C(0xf6ca1cb527787b13), UINT64_C(0x17a2ecc414a03f7f) }, { UINT64_C(0xf47ca3e2715699d7), UINT64_C(0x1d8ba7f519c84f5f) },
+    { UINT64_C(0xf8cde66d86d62026), UINT64_C(0x127748f9301d319b) }, { UINT64_C(0xf7016008e88ba830), UINT64_C(0x17151b377c247e02) },
+    { UINT64_C(0xb4c1b80b22ae923c), UINT64_C(0x1cda62055b2d9d83) }, { UINT64_C(0x50f91306f5ad1b65), UINT64_C(0x12087d4358fc8272) },
+    { UINT64_C(0xe53757c8b318623f), UINT64_C(0x168a9c942f3ba30e) }, { UINT64_C(0x9e852dbadfde7acf), UINT64_C(0x1c2d43b93b0a8bd2) },
+    { UINT64_C(0xa3133c94cbeb0cc1), UINT64_C(0x119c4a53c4e69763) }, { UINT64_C(0x8bd80bb9fee5cff1), UINT64_C(0x16035ce8b6203d3c) },
+    { UINT64_C(0xaece0ea87e9f43ee), UINT64_C(0x1b843422e3a84c8b) }, { UINT64_C(0x4d40c9294f238a75), UINT64_C(0x1132a095ce492fd7) },
+    { UINT64_C(0x2090fb73a2ec6d12), UINT64_C(0x157f48bb41db7bcd) }, { UINT64_C(0x68b53a508ba78856), UINT64_C(0x1adf1aea12525ac0) },
+    { UINT64_C(0x417144725748b536), UINT64_C(0x10cb70d24b7378b8) }, { UINT64_C(0x51cd958eed1ae283), UINT64_C(0x14fe4d06de5056e6) },
+    { UINT64_C(0xe640faf2a8619b24), UINT64_C(0x1a3de04895e46c9f) }, { UINT64_C(0xefe89cd7a93d00f7), UINT64_C(0x1066ac2d5daec3e3) },
+    { UINT64_C(0xebe2c40d938c4134), UINT64_C(0x14805738b51a74dc) }, { UINT64_C(0x26db7510f86f5181), UINT64_C(0x19a06d06e2611214) },
+    { UINT64_C(0x9849292a9b4592f1), UINT64_C(0x100444244d7cab4c) }, { UINT64_C(0xbe5b73754216f7ad), UINT64_C(0x1405552d60dbd61f) },
+    { UINT64_C(0xadf25052929cb598), UINT64_C(0x1906aa78b912cba7) }, { UINT64_C(0x996ee4673743e2ff), UINT64_C(0x1f485516e7577e91) },
+    { UINT64_C(0xffe54ec0828a6ddf), UINT64_C(0x138d352e5096af1a) }, { UINT64_C(0xbfdea270a32d0957), UINT64_C(0x18708279e4bc5ae1) },
+    { UINT64_C(0x2fd64b0ccbf84bad), UINT64_C(0x1e8ca3185deb719a) }, { UINT64_C(0x5de5eee7ff7b2f4c), UINT64_C(0x1317e5ef3ab32700) },
+    { UINT64_C(0x755f6aa1ff59fb1f), UINT64_C(0x17dddf6b095ff0c0) }, { UINT64_C(0x92b7454a7f3079e7), UINT64_C(0x1dd55745cbb7ecf0) },
+    { UINT64_C(0x5bb28b4e8f7e4c30), UINT64_C(0x12a5568b9f52f416) }, { UINT64_C(0xf29f2e22335ddf3c), UINT64_C(0x174eac2e8727b11b) },
+    { UINT64_C(0xef46f9aac035570b), UINT64_C(0x1d22573a28f19d62) }, { UINT64_C(0xd58c5c0ab8215667), UINT64_C(0x123576845997025d) },
+    { UINT64_C(0x4aef730d6629ac01), UINT64_C(0x16c2d4256ffcc2f5) }, { UINT64_C(0x9dab4fd0bfb41701), UINT64_C(0x1c73892ecbfbf3b2) },
+    { UINT64_C(0xa28b11e277d08e60), UINT64_C(0x11c835bd3f7d784f) }, { UINT64_C(0x8b2dd65b15c4b1f9), UINT64_C(0x163a432c8f5cd663) },
+    { UINT64_C(0x6df94bf1db35de77), UINT64_C(0x1bc8d3f7b3340bfc) }, { UINT64_C(0xc4bbcf772901ab0a), UINT64_C(0x115d847ad000877d) },
+    { UINT64_C(0x35eac354f34215cd), UINT64_C(0x15b4e5998400a95d) }, { UINT64_C(0x8365742a30129b40), UINT64_C(0x1b221effe500d3b4) },
+    { UINT64_C(0xd21f689a5e0ba108), UINT64_C(0x10f5535fef208450) }, { UINT64_C(0x06a742c0f58e894a), UINT64_C(0x1532a837eae8a565) },
+    { UINT64_C(0x4851137132f22b9d), UINT64_C(0x1a7f5245e5a2cebe) }, { UINT64_C(0xed32ac26bfd75b42), UINT64_C(0x108f936baf85c136) },
+    { UINT64_C(0xa87f57306fcd3212), UINT64_C(0x14b378469b673184) }, { UINT64_C(0xd29f2cfc8bc07e97), UINT64_C(0x19e056584240fde5) },
+    { UINT64_C(0xa3a37c1dd7584f1e), UINT64_C(0x102c35f729689eaf) }, { UINT64_C(0x8c8c5b254d2e62e6), UINT64_C(0x14374374f3c2c65b) },
+    { UINT64_C(0x6faf71eea079fb9f), UINT64_C(0x1945145230b377f2) }, { UINT64_C(0x0b9b4e6a48987a87), UINT64_C(0x1f965966bce055ef) },
+    { UINT64_C(0x674111026d5f4c94), UINT64_C(0x13bdf7e0360c35b5) }, { UINT64_C(0xc111554308b71fba), UINT64_C(0x18ad75d8438f4322) },
+    { UINT64_C(0x7155aa93cae4e7a8), UINT64_C(0x1ed8d34e547313eb) }, { UINT64_C(0x26d58a9c5ecf10c9), UINT64_C(0x13478410f4c7ec73) },
+    { UINT64_C(0xf08aed437682d4fb), UINT64_C(0x1819651531f9e78f) }, { UINT64_C(0xecada89454238a3a), UINT64_C(0x1e1fbe5a7e786173) },
+    { UINT64_C(0x73ec895cb4963664), UINT64_C(0x12d3d6f88f0b3ce8) }, { UINT64_C(0x90e7abb3e1bbc3fd), UINT64_C(0x1788ccb6b2ce0c22) },
+    { UINT64_C(0x352196a0da2ab4fd), UINT64_C(0x1d6affe45f818f2b) }, { UINT64_C(0x0134fe24885ab11e), UINT64_C(0x1262dfeebbb0f97b) },
+    { UINT64_C(0xc1823dadaa715d65), UINT64_C(0x16fb97ea6a9d37d9) }, { UINT64_C(0x31e2cd19150db4bf), UINT64_C(0x1cba7de5054485d0) },
+    { UINT64_C(0x1f2dc02fad2890f7), UINT64_C(0x11f48eaf234ad3a2) }, { UINT64_C(0xa6f9303b9872b535), UINT64_C(0x1671b25aec1d888a) },
+    { UINT64_C(0x50b77c4a7e8f6282), UINT64_C(0x1c0e1ef1a724eaad) }, { UINT64_C(0x5272adae8f199d91), UINT64_C(0x1188d357087712ac) },
+    { UINT64_C(0x670f591a32e004f6), UINT64_C(0x15eb082cca94d757) }, { UINT64_C(0x40d32f60bf980633), UINT64_C(0x1b65ca37fd3a0d2d) },
+    { UINT64_C(0x4883fd9c77bf03e0), UINT64_C(0x111f9e62fe44483c) }, { UINT64_C(0x5aa4fd0395aec4d8), UINT64_C(0x156785fbbdd55a4b) },
+    { UINT64_C(0x314e3c447b1a760e), UINT64_C(0x1ac1677aad4ab0de) }, { UINT64_C(0xded0e5aaccf089c9), UINT64_C(0x10b8e0acac4eae8a) },
+    { UINT64_C(0x96851f15802cac3b), UINT64_C(0x14e718d7d7625a2d) }, { UINT64_C(0xfc2666dae037d74a), UINT64_C(0x1a20df0dcd3af0b8) },
+    { UINT64_C(0x9d980048cc22e68e), UINT64_C(0x10548b68a044d673) }, { UINT64_C(0x84fe005aff2ba032), UINT64_C(0x1469ae42c8560c10) },
+    { UINT64_C(0xa63d8071bef6883e), UINT64_C(0x198419d37a6b8f14) }, { UINT64_C(0xcfcce08e2eb42a4e), UINT64_C(0x1fe52048590672d9) },
+    { UINT64_C(0x21e00c58dd309a70), UINT64_C(0x13ef342d37a407c8) }, { UINT64_C(0x2a580f6f147cc10d), UINT64_C(0x18eb0138858d09ba) },
+    { UINT64_C(0xb4ee134ad99bf150), UINT64_C(0x1f25c186a6f04c28) }, { UINT64_C(0x7114cc0ec80176d2), UINT64_C(0x137798f428562f99) },
+    { UINT64_C(0xcd59ff127a01d486), UINT64_C(0x18557f31326bbb7f) }, { UINT64_C(0xc0b07ed7188249a8), UINT64_C(0x1e6adefd7f06aa5f) },
+    { UINT64_C(0xd86e4f466f516e09), UINT64_C(0x1302cb5e6f642a7b) }, { UINT64_C(0xce89e3180b25c98b), UINT64_C(0x17c37e360b3d351a) },
+    { UINT64_C(0x822c5bde0def3bee), UINT64_C(0x1db45dc38e0c8261) }, { UINT64_C(0xf15bb96ac8b58575), UINT64_C(0x1290ba9a38c7d17c) },
+    { UINT64_C(0x2db2a7c57ae2e6d2), UINT64_C(0x1734e940c6f9c5dc) }, { UINT64_C(0x391f51b6d99ba086), UINT64_C(0x1d022390f8b83753) },
+    { UINT64_C(0x03b3931248014454), UINT64_C(0x1221563a9b732294) }, { UINT64_C(0x04a077d6da019569), UINT64_C(0x16a9abc9424feb39) },
+    { UINT64_C(0x45c895cc9081fac3), UINT64_C(0x1c5416bb92e3e607) }, { UINT64_C(0x8b9d5d9fda513cba), UINT64_C(0x11b48e353bce6fc4) },
+    { UINT64_C(0xae84b507d0e58be8), UINT64_C(0x1621b1c28ac20bb5) }, { UINT64_C(0x1a25e249c51eeee3), UINT64_C(0x1baa1e332d728ea3) },
+    { UINT64_C(0xf057ad6e1b33554d), UINT64_C(0x114a52dffc679925) }, { UINT64_C(0x6c6d98c9a2002aa1), UINT64_C(0x159ce797fb817f6f) },
+    { UINT64_C(0x4788fefc0a803549), UINT64_C(0x1b04217dfa61df4b) }, { UINT64_C(0x0cb59f5d8690214e), UINT64_C(0x10e294eebc7d2b8f) },
+    { UINT64_C(0xcfe30734e83429a1), UINT64_C(0x151b3a2a6b9c7672) }, { UINT64_C(0x83dbc9022241340a), UINT64_C(0x1a6208b50683940f) },
+    { UINT64_C(0xb2695da15568c086), UINT64_C(0x107d457124123c89) }, { UINT64_C(0x1f03b509aac2f0a7), UINT64_C(0x149c96cd6d16cbac) },
+    { UINT64_C(0x26c4a24c1573acd1), UINT64_C(0x19c3bc80c85c7e97) }, { UINT64_C(0x783ae56f8d684c03), UINT64_C(0x101a55d07d39cf1e) },
+    { UINT64_C(0x16499ecb70c25f03), UINT64_C(0x1420eb449c8842e6) }, { UINT64_C(0x9bdc067e4cf2f6c4), UINT64_C(0x19292615c3aa539f) },
+    { UINT64_C(0x82d3081de02fb476), UINT64_C(0x1f736f9b3494e887) }, { UINT64_C(0xb1c3e512ac1dd0c9), UINT64_C(0x13a825c100dd1154) },
+    { UINT64_C(0xde34de57572544fc), UINT64_C(0x18922f31411455a9) }, { UINT64_C(0x55c215ed2cee963b), UINT64_C(0x1eb6bafd91596b14) },
+    { UINT64_C(0xb5994db43c151de5), UINT64_C(0x133234de7ad7e2ec) }, { UINT64_C(0xe2ffa1214b1a655e), UINT64_C(0x17fec216198ddba7) },
+    { UINT64_C(0xdbbf89699de0feb6), UINT64_C(0x1dfe729b9ff15291) }, { UINT64_C(0x2957b5e202ac9f31), UINT64_C(0x12bf07a143f6d39b) },
+    { UINT64_C(0xf3ada35a8357c6fe), UINT64_C(0x176ec98994f48881) }, { UINT64_C(0x70990c31242db8bd), UINT64_C(0x1d4a7bebfa31aaa2) },
+    { UINT64_C(0x865fa79eb69c9376), UINT64_C(0x124e8d737c5f0aa5) }, { UINT64_C(0xe7f791866443b854), UINT64_C(0x16e230d05b76cd4e) },
+    { UINT64_C(0xa1f575e7fd54a669), UINT64_C(0x1c9abd04725480a2) }, { UINT64_C(0xa53969b0fe54e801), UINT64_C(0x11e0b622c774d065) },
+    { UINT64_C(0x0e87c41d3dea2202), UINT64_C(0x1658e3ab7952047f) }, { UINT64_C(0xd229b5248d64aa82), UINT64_C(0x1bef1c9657a6859e) },
+    { UINT64_C(0x435a1136d85eea91), UINT64_C(0x117571ddf6c81383) }, { UINT64_C(0x143095848e76a536), UINT64_C(0x15d2ce55747a1864) },
+    { UINT64_C(0x193cbae5b2144e83), UINT64_C(0x1b4781ead1989e7d) }, { UINT64_C(0x2fc5f4cf8f4cb112), UINT64_C(0x110cb132c2ff630e) },
+    { UINT64_C(0xbbb77203731fdd56), UINT64_C(0x154fdd7f73bf3bd1) }, { UINT64_C(0x2aa54e844fe7d4ac), UINT64_C(0x1aa3d4df50af0ac6) },
+    { UINT64_C(0xdaa75112b1f0e4eb), UINT64_C(0x10a6650b926d66bb) }, { UINT64_C(0xd15125575e6d1e26), UINT64_C(0x14cffe4e7708c06a) },
+    { UINT64_C(0x85a56ead360865b0), UINT64_C(0x1a03fde214caf085) }, { UINT64_C(0x7387652c41c53f8e), UINT64_C(0x10427ead4cfed653) },
+    { UINT64_C(0x50693e7752368f71), UINT64_C(0x14531e58a03e8be8) }, { UINT64_C(0x64838e1526c4334e), UINT64_C(0x1967e5eec84e2ee2) },
+    { UINT64_C(0xfda4719a70754022), UINT64_C(0x1fc1df6a7a61ba9a) }, { UINT64_C(0xde86c70086494815), UINT64_C(0x13d92ba28c7d14a0) },
+    { UINT64_C(0x162878c0a7db9a1a), UINT64_C(0x18cf768b2f9c59c9) }, { UINT64_C(0x5bb296f0d1d280a1), UINT64_C(0x1f03542dfb83703b) },
+    { UINT64_C(0x194f9e5683239064), UINT64_C(0x1362149cbd322625) }, { UINT64_C(0x5fa385ec23ec747e), UINT64_C(0x183a99c3ec7eafae) },
+    { UINT64_C(0xf78c67672ce7919d), UINT64_C(0x1e494034e79e5b99) }, { UINT64_C(0x3ab7c0a07c10bb02), UINT64_C(0x12edc82110c2f940) },
+    { UINT64_C(0x4965b0c89b14e9c3), UINT64_C(0x17a93a2954f3b790) }, { UINT64_C(0x5bbf1cfac1da2433), UINT64_C(0x1d9388b3aa30a574) },
+    { UINT64_C(0xb957721cb92856a0), UINT64_C(0x127c35704a5e6768) }, { UINT64_C(0xe7ad4ea3e7726c48), UINT64_C(0x171b42cc5cf60142) },
+    { UINT64_C(0xa198a24ce14f075a), UINT64_C(0x1ce2137f74338193) }, { UINT64_C(0x44ff65700cd16498), UINT64_C(0x120d4c2fa8a030fc) },
+    { UINT64_C(0x563f3ecc1005bdbe), UINT64_C(0x16909f3b92c83d3b) }, { UINT64_C(0x2bcf0e7f14072d2e), UINT64_C(0x1c34c70a777a4c8a) },
+    { UINT64_C(0x5b61690f6c847c3d), UINT64_C(0x11a0fc668aac6fd6) }, { UINT64_C(0xf239c35347a59b4c), UINT64_C(0x16093b802d578bcb) },
+    { UINT64_C(0xeec83428198f021f), UINT64_C(0x1b8b8a6038ad6ebe) }, { UINT64_C(0x553d20990ff96153), UINT64_C(0x1137367c236c6537) },
+    { UINT64_C(0x2a8c68bf53f7b9a8), UINT64_C(0x1585041b2c477e85) }, { UINT64_C(0x752f82ef28f5a812), UINT64_C(0x1ae64521f7595e26) },
+    { UINT64_C(0x093db1d57999890b), UINT64_C(0x10cfeb353a97dad8) }, { UINT64_C(0x0b8d1e4ad7ffeb4e), UINT64_C(0x1503e602893dd18e) },
+    { UINT64_C(0x8e7065dd8dffe622), UINT64_C(0x1a44df832b8d45f1) }, { UINT64_C(0xf9063faa78bfefd5), UINT64_C(0x106b0bb1fb384bb6) },
+    { UINT64_C(0xb747cf9516efebca), UINT64_C(0x1485ce9e7a065ea4) }, { UINT64_C(0xe519c37a5cabe6bd), UINT64_C(0x19a742461887f64d) },
+    { UINT64_C(0xaf301a2c79eb7036), UINT64_C(0x1008896bcf54f9f0) }, { UINT64_C(0xdafc20b798664c43), UINT64_C(0x140aabc6c32a386c) },
+    { UINT64_C(0x11bb28e57e7fdf54), UINT64_C(0x190d56b873f4c688) }, { UINT64_C(0x1629f31ede1fd72a), UINT64_C(0x1f50ac6690f1f82a) },
+    { UINT64_C(0x4dda37f34ad3e67a), UINT64_C(0x13926bc01a973b1a) }, { UINT64_C(0xe150c5f01d88e019), UINT64_C(0x187706b0213d09e0) },
+    { UINT64_C(0x19a4f76c24eb181f), UINT64_C(0x1e94c85c298c4c59) }, { UINT64_C(0xb0071aa39712ef13), UINT64_C(0x131cfd3999f7afb7) },
+    { UINT64_C(0x9c08e14c7cd7aad8), UINT64_C(0x17e43c8800759ba5) }, { UINT64_C(0x030b199f9c0d958e), UINT64_C(0x1ddd4baa0093028f) },
+    { UINT64_C(0x61e6f003c1887d79), UINT64_C(0x12aa4f4a405be199) }, { UINT64_C(0xba60ac04b1ea9cd7), UINT64_C(0x1754e31cd072d9ff) },
+    { UINT64_C(0xa8f8d705de65440d), UINT64_C(0x1d2a1be4048f907f) }, { UINT64_C(0xc99b8663aaff4a88), UINT64_C(0x123a516e82d9ba4f) },
+    { UINT64_C(0xbc0267fc95bf1d2a), UINT64_C(0x16c8e5ca239028e3) }, { UINT64_C(0xab0301fbbb2ee474), UINT64_C(0x1c7b1f3cac74331c) },
+    { UINT64_C(0xeae1e13d54fd4ec9), UINT64_C(0x11ccf385ebc89ff1) }, { UINT64_C(0x659a598caa3ca27b), UINT64_C(0x1640306766bac7ee) },
+    { UINT64_C(0xff00efefd4cbcb1a), UINT64_C(0x1bd03c81406979e9) }, { UINT64_C(0x3f6095f5e4ff5ef0), UINT64_C(0x116225d0c841ec32) },
+    { UINT64_C(0xcf38bb735e3f36ac), UINT64_C(0x15baaf44fa52673e) }, { UINT64_C(0x8306ea5035cf0457), UINT64_C(0x1b295b1638e7010e) },
+    { UINT64_C(0x11e4527221a162b6), UINT64_C(0x10f9d8ede39060a9) }, { UINT64_C(0x565d670eaa09bb64), UINT64_C(0x15384f295c7478d3) },
+    { UINT64_C(0x2bf4c0d2548c2a3d), UINT64_C(0x1a8662f3b3919708) }, { UINT64_C(0x1b78f88374d79a66), UINT64_C(0x1093fdd8503afe65) },
+    { UINT64_C(0x625736a4520d8100), UINT64_C(0x14b8fd4e6449bdfe) }, { UINT64_C(0xfaed044d6690e140), UINT64_C(0x19e73ca1fd5c2d7d) },
+    { UINT64_C(0xbcd422b0601a8cc8), UINT64_C(0x103085e53e599c6e) }, { UINT64_C(0x6c092b5c78212ffa), UINT64_C(0x143ca75e8df0038a) },
+    { UINT64_C(0x070b763396297bf8), UINT64_C(0x194bd136316c046d) }, { UINT64_C(0x48ce53c07bb3daf6), UINT64_C(0x1f9ec583bdc70588) },
+    { UINT64_C(0x2d80f4584d5068da), UINT64_C(0x13c33b72569c6375) }, { UINT64_C(0x78e1316e60a48310), UINT64_C(0x18b40a4eec437c52) }
+};
 
-typedef printf_floating_point_zero_pure_data_t * printf_floating_point_zero_pure_data_ref;
+/*!
+    @function fp64_shortest_pow5_bits_inline
+    @return bit length of 5^(e), valid for 0 < e <= 3528
+ */
+static inline int fp64_shortest_pow5_bits_inline(int e) {
+    return (int)(((uint32_t)e * 1217359) >> 19) + 1;
+}
 
-static bool printf_floating_point_zero_pure_function(printf_core_ref _Nonnull core,
-                                                     printf_interprate_ref _Nonnull interprate,
-                                                     size_t pure_width,
-                                                     void * _Nonnull input);
+/*!
+    @function fp64_shortest_log10_pow2_inline
+    @return floor(e x log10(2)), valid for 0 <= e <= 1650
+ */
+static inline int fp64_shortest_log10_pow2_inline(int e) {
+    return (int)(((uint32_t)e * 78913) >> 18);
+}
 
-static bool printf_output_specifier_floating_point_zero(printf_core_ref _Nonnull core, printf_interprate_ref _Nonnull interprate, fp_info_ref _Nonnull info) {
-    if(core != NULL && interprate != NULL && info != NULL && printf_specifier_type_is_floating_point_inline(interprate->type)) {
-        
-        DEBUG_ASSERT(interprate->width_type != printf_interprate_adjustment_waiting_input);
-        DEBUG_ASSERT(interprate->precision_type != printf_interprate_adjustment_waiting_input);
-        
-        size_t pure_width = 0;
+/*!
+    @function fp64_shortest_log10_pow5_inline
+    @return floor(e x log10(5)), valid for 0 <= e <= 2620
+ */
+static inline int fp64_shortest_log10_pow5_inline(int e) {
+    return (int)(((uint32_t)e * 732923) >> 20);
+}
+
+static inline bool fp64_shortest_multiple_of_pow5_inline(uint64_t value, int p) {
+    DEBUG_ASSERT(value != 0);
+    int count = 0;
+    while(value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+    return count >= p;
+}
+
+static inline bool fp64_shortest_multiple_of_pow2_inline(uint64_t value, int p) {
+    DEBUG_ASSERT(p >= 0 && p < 64);
+    return (value & ((UINT64_C(1) << p) - 1)) == 0;
+}
+
+#endif
+
+#ifdef PRINTF_FLOATING_POINT_SHORTEST_64
+
+/*!
+    @function fp64_shortest_multiply_shift_inline
+    @return (value x multiplier) >> shift, multiplier is 128 bit, shift is above 64
+ */
+static inline uint64_t fp64_shortest_multiply_shift_inline(uint64_t value, const uint64_t * _Nonnull multiplier, int shift) {
+    DEBUG_ASSERT(shift > 64);
+    unsigned __int128 low = (unsigned __int128)value * multiplier[0];
+    unsigned __int128 high = (unsigned __int128)value * multiplier[1];
+    return (uint64_t)(((low >> 64) + high) >> (shift - 64));
+}
+
+/*!
+    @function fp64_shortest_digits
+    @abstract shortest decimal [output x 10^(exponent)] strictly inside the nearby midpoints of a normal binary 64
+    @discussion makes the same decision as floating_point_base_convert_query_next_digit,
+                bounds are exclusive and an exact half rounds down
+    @param significand explicit significand bits
+    @param raw_exponent biased exponent, normal only
+ */
+static bool fp64_shortest_digits(uint64_t significand,
+                                 unsigned int raw_exponent,
+                                 uint64_t * _Nonnull output,
+                                 int * _Nonnull exponent) {
+    if(output != NULL && exponent != NULL && raw_exponent > 0 && raw_exponent < FP64_EXPONENT_RAW_MAX) {
+        
+        // value scaled by 4 leaves room for the nearby midpoints
+        int e2 = (int)raw_exponent - FP64_EXPONENT_BASE - FP64_SIGNIFICAND_BIT - 2;
+        uint64_t mv = ((UINT64_C(1) << FP64_SIGNIFICAND_BIT) | significand) * 4;
+        
+        // nearby_down_decrease_exponent when all significand bit are zero
+        uint64_t mm_shift = significand != 0;
+        
+        uint64_t vr, vp, vm;
+        int e10;
+        bool vr_is_trailing_zeros = false;
+        
+        if(e2 >= 0) {
+            int q = fp64_shortest_log10_pow2_inline(e2) - (e2 > 3);
+            int k = FP64_SHORTEST_POW5_INVERSE_BIT + fp64_shortest_pow5_bits_inline(q) - 1;
+            int shift = - e2 + q + k;
+            DEBUG_ASSERT(q < FP64_SHORTEST_POW5_INVERSE_TABLE_SIZE);
+            const uint64_t *multiplier = fp64_shortest_pow5_inverse_split[q];
+            e10 = q;
+            vr = fp64_shortest_multiply_shift_inline(mv, multiplier, shift);
+            vp = fp64_shortest_multiply_shift_inline(mv + 2, multiplier, shift);
+            vm = fp64_shortest_multiply_shift_inline(mv - 1 - mm_shift, multiplier, shift);
+            
+            // 5^(q) could divide the 55 bit value only for small q
+            if(q <= 21) {
+                if(mv % 5 == 0) vr_is_trailing_zeros = fp64_shortest_multiple_of_pow5_inline(mv, q);
+                else vp -= fp64_shortest_multiple_of_pow5_inline(mv + 2, q);    // upper bound is exclusive
+            }
+        }
+        else {
+            int q = fp64_shortest_log10_pow5_inline(- e2) - (- e2 > 1);
+            int i = - e2 - q;
+            int k = fp64_shortest_pow5_bits_inline(i) - FP64_SHORTEST_POW5_BIT;
+            int shift = q - k;
+            DEBUG_ASSERT(i < FP64_SHORTEST_POW5_TABLE_SIZE);
+            const uint64_t *multiplier = fp64_shortest_pow5_split[i];
+            e10 = q + e2;
+            vr = fp64_shortest_multiply_shift_inline(mv, multiplier, shift);
+            vp = fp64_shortest_multiply_shift_inline(mv + 2, multiplier, shift);
+            vm = fp64_shortest_multiply_shift_inline(mv - 1 - mm_shift, multiplier, shift);
+            
+            if(q <= 1) {
+                // mv has at least two trailing zero bits, so is the upper bound
+                vr_is_trailing_zeros = true;
+                vp--;                                                           // upper bound is exclusive
+            }
+            else if(q < 63) vr_is_trailing_zeros = fp64_shortest_multiple_of_pow2_inline(mv, q);
+        }
         
-        switch (interprate->type) {
-            case printf_specifier_f:
-            case printf_specifier_F:
-                pure_width += 1;        // 0
-                if(interprate->precision > 0)
-                    pure_width += interprate->precision + 1;        // .xxx
-                else if(interprate->flag & printf_interprate_flag_complex)
-                    pure_width += 1;                                // .
-                break;
-            case printf_specifier_e:
-            case printf_specifier_E:
-                pure_width += 1;        // 0
-                if(interprate->precision > 0)
-                    pure_width += interprate->precision + 1;        // .xxx
-                else if(interprate->flag & printf_interprate_flag_complex)
-                    pure_width += 1;                                // .
-                pure_width += 4;                                    // (e/E)+00
-                break;
-            case printf_specifier_g:
-            case printf_specifier_G:
-                // must be in %f style format
-                pure_width += 1;        // 0
-                if(interprate->flag & printf_interprate_flag_complex)
-                    pure_width += 1;                                // .
-                break;
-            case printf_specifier_a:
-            case printf_specifier_A:
-                pure_width += 3;        // 0x0
-                if(interprate->precision_type == printf_interprate_adjustment_unspecified)
-                    interprate->precision = 0;
-                if(interprate->precision > 0)
-                    pure_width += interprate->precision + 1;        // .xxx
-                else if(interprate->flag & printf_interprate_flag_complex)
-                    pure_width += 1;                                // .
-                pure_width += 3;        // p+0
-                break;
-            case printf_specifier_invalid:
-            default: DEBUG_RETURN(false);
+        // remove digits while the bounds still differ in the remaining digits
+        int removed = 0;
+        uint64_t value;
+        if(vr_is_trailing_zeros) {
+            // value may be exact, the last removed digit tells a tie apart
+            unsigned int last_removed_digit = 0;
+            while(vp / 10 > vm / 10) {
+                vr_is_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (unsigned int)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+            if(vr_is_trailing_zeros && last_removed_digit == 5) last_removed_digit = 4;    // exact half rounds down
+            value = vr + (vr == vm || last_removed_digit >= 5);
+        }
+        else {
+            bool round_up = false;
+            if(vp / 100 > vm / 100) {
+                round_up = vr % 100 >= 50;
+                vr /= 100;
+                vp /= 100;
+                vm /= 100;
+                removed += 2;
+            }
+            while(vp / 10 > vm / 10) {
+                round_up = vr % 10 >= 5;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+            value = vr + (vr == vm || round_up);
         }
         
-        printf_floating_point_zero_pure_data_t pure_data_store;
-        printf_floating_point_zero_pure_data_ref pure_data = &pure_data_store;
-        pure_data->pure_width = pure_width;
+        output[0] = value;
+        exponent[0] = e10 + removed;
+        return true;
+    } DEBUG_ELSE
+    return false;
+}
+
+#endif
+
+#pragma mark floating point shortest digits [binary 32]
+
+#ifdef PRINTF_FLOATING_POINT_SHORTEST_32
+
+/*!
+    @function fp32_shortest_multiply_shift_inline
+    @return (value x multiplier) >> shift, value is up to 26 bit, multiplier is up to 62 bit, shift is above 32
+ */
+static inline uint64_t fp32_shortest_multiply_shift_inline(uint32_t value, uint64_t multiplier, int shift) {
+    DEBUG_ASSERT(shift > 32);
+    uint64_t low = (uint64_t)value * (uint32_t)multiplier;
+    uint64_t high = (uint64_t)value * (multiplier >> 32);
+    return ((low >> 32) + high) >> (shift - 32);
+}
+
+/*!
+    @function fp32_shortest_digits
+    @abstract shortest decimal [output x 10^(exponent)] strictly inside the nearby midpoints of a normal binary 32
+    @discussion same steps as fp64_shortest_digits, the high 64 bit of each table entry [61 bit] is
+                precise enough for a 26 bit value, the inverse one is rounded up again
+    @param significand explicit significand bits
+    @param raw_exponent biased exponent, normal only
+ */
+static bool fp32_shortest_digits(uint32_t significand,
+                                 unsigned int raw_exponent,
+                                 uint64_t * _Nonnull output,
+                                 int * _Nonnull exponent) {
+    if(output != NULL && exponent != NULL && raw_exponent > 0 && raw_exponent < FP32_EXPONENT_RAW_MAX) {
+        
+        // value scaled by 4 leaves room for the nearby midpoints
+        int e2 = (int)raw_exponent - FP32_EXPONENT_BASE - FP32_SIGNIFICAND_BIT - 2;
+        uint32_t mv = ((UINT32_C(1) << FP32_SIGNIFICAND_BIT) | significand) * 4;
+        
+        // nearby_down_decrease_exponent when all significand bit are zero
+        uint32_t mm_shift = significand != 0;
+        
+        // one more digit than binary 32 needs is kept, so vr is up to 33 bit
+        uint64_t vr, vp, vm;
+        int e10;
+        bool vr_is_trailing_zeros = false;
+        
+        if(e2 >= 0) {
+            int q = fp64_shortest_log10_pow2_inline(e2) - (e2 > 3);
+            int k = FP64_SHORTEST_POW5_INVERSE_BIT - 64 + fp64_shortest_pow5_bits_inline(q) - 1;
+            int shift = - e2 + q + k;
+            DEBUG_ASSERT(q < FP64_SHORTEST_POW5_INVERSE_TABLE_SIZE);
+            uint64_t multiplier = fp64_shortest_pow5_inverse_split[q][1] + 1;
+            e10 = q;
+            vr = fp32_shortest_multiply_shift_inline(mv, multiplier, shift);
+            vp = fp32_shortest_multiply_shift_inline(mv + 2, multiplier, shift);
+            vm = fp32_shortest_multiply_shift_inline(mv - 1 - mm_shift, multiplier, shift);
+            
+            // 5^(q) could divide the 26 bit value only for small q
+            if(q <= 11) {
+                if(mv % 5 == 0) vr_is_trailing_zeros = fp64_shortest_multiple_of_pow5_inline(mv, q);
+                else vp -= fp64_shortest_multiple_of_pow5_inline(mv + 2, q);    // upper bound is exclusive
+            }
+        }
+        else {
+            int q = fp64_shortest_log10_pow5_inline(- e2) - (- e2 > 1);
+            int i = - e2 - q;
+            int k = fp64_shortest_pow5_bits_inline(i) - (FP64_SHORTEST_POW5_BIT - 64);
+            int shift = q - k;
+            DEBUG_ASSERT(i < FP64_SHORTEST_POW5_TABLE_SIZE);
+            uint64_t multiplier = fp64_shortest_pow5_split[i][1];
+            e10 = q + e2;
+            vr = fp32_shortest_multiply_shift_inline(mv, multiplier, shift);
+            vp = fp32_shortest_multiply_shift_inline(mv + 2, multiplier, shift);
+            vm = fp32_shortest_multiply_shift_inline(mv - 1 - mm_shift, multiplier, shift);
+            
+            if(q <= 1) {
+                // mv has at least two trailing zero bits, so is the upper bound
+                vr_is_trailing_zeros = true;
+                vp--;                                                           // upper bound is exclusive
+            }
+            else if(q < 32) vr_is_trailing_zeros = fp64_shortest_multiple_of_pow2_inline(mv, q);
+        }
         
-        bool is_floating_negative = floating_point_info_query_sign_bit_inline(info);
+        // remove digits while the bounds still differ in the remaining digits
+        int removed = 0;
+        unsigned int last_removed_digit = 0;
+        while(vp / 10 > vm / 10) {
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (unsigned int)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        // value may be exact, the last removed digit tells a tie apart
+        if(vr_is_trailing_zeros && last_removed_digit == 5) last_removed_digit = 4;    // exact half rounds down
         
-        return printf_core_output_flag_width_help(core,
-                                                  interprate,
-                                                  pure_width,
-                                                  printf_complex_prefix_none,
-                                                  is_floating_negative,
-                                                  printf_floating_point_zero_pure_function,
-                                                  pure_data);
+        output[0] = vr + (vr == vm || last_removed_digit >= 5);
+        exponent[0] = e10 + removed;
+        return true;
     } DEBUG_ELSE
     return false;
 }
 
-static bool printf_floating_point_zero_pure_function(printf_core_ref _Nonnull core,
-                                                     printf_interprate_ref _Nonnull interprate,
-                                                     size_t pure_width,
-                                                     void * _Nonnull input) {
-    if(core != NULL && interprate != NULL && input != NULL) {
-        printf_floating_point_zero_pure_data_ref pure_data = (printf_floating_point_zero_pure_data_ref)input;
-        if(pure_data->pure_width == pure_width) {
-            switch (interprate->type) {
-                case printf_specifier_f:
-                case printf_specifier_F:
-                    printf_core_output_character(core, CHARACTER_0);
-                    if(interprate->precision > 0) {
-                        printf_core_output_character(core, CHARACTER_dot);
-                        for(size_t index = 0; index < interprate->precision; index++)
-                            printf_core_output_character(core, CHARACTER_0);
+#endif
+
+#if defined PRINTF_FLOATING_POINT_SHORTEST_64 || defined PRINTF_FLOATING_POINT_SHORTEST_32
+
+/*!
+    @function printf_output_specifier_floating_point_fpbc_prepare_shortest
+    @abstract fill fpbc with shortest digits of a normal binary 64 or binary 32, no extended_integer is needed after
+    @discussion only if the specifier keeps no less digits than the shortest ones and at most 15 [binary 64]
+                or 6 [binary 32], half of that decimal grid is more than half a binary ulp,
+                so the shortest digits are the exact value rounded
+    @return false if not handled here, exact or generic fpbc should be used
+ */
+static bool printf_output_specifier_floating_point_fpbc_prepare_shortest(printf_interprate_ref _Nonnull interprate,
+                                                                         fp_info_ref _Nonnull info,
+                                                                         fpbc_ref _Nonnull fpbc) {
+    if(interprate != NULL && info != NULL && fpbc != NULL) {
+        uint64_t value;
+        int exponent;
+        long keep_max;
+        switch (info->type) {
+#ifdef PRINTF_FLOATING_POINT_SHORTEST_32
+            case IEEE754_type_32:
+                if(!fp32_shortest_digits(floating_point_info_query_significand_32_inline(info),
+                                         floating_point_info_query_raw_exponent_inline(info), &value, &exponent))
+                    DEBUG_RETURN(false);
+                keep_max = 6;
+                break;
+#endif
+#ifdef PRINTF_FLOATING_POINT_SHORTEST_64
+            case IEEE754_type_64:
+                if(!fp64_shortest_digits(floating_point_info_query_significand_inline(info),
+                                         floating_point_info_query_raw_exponent_inline(info), &value, &exponent))
+                    DEBUG_RETURN(false);
+                keep_max = 15;
+                break;
+#endif
+            default: return false;
+        }
+        
+        long amount = (long)printf_integer_decimal_digits_amount_inline(value);
+        long keep;
+        if(!floating_point_base_convert_digits_kept_inline(interprate, exponent + amount, &keep)) return false;
+        if(keep > keep_max || amount > keep) return false;
+        
+        return floating_point_base_convert_prepare_digits_inline(fpbc, value, exponent);
+    } DEBUG_ELSE
+    return false;
+}
+
+#endif
+
+#pragma mark floating point fixed precision [binary 64, 80 bit & binary 128]
+
+#ifdef PRINTF_FLOATING_POINT_FIXED_64
+
+/*!
+    @function fp64_fixed_pow5_inline
+    @abstract 5^(e) from 10^(e) / 2^(e), at most two table entries
+    @return false if e is beyond 38, 5^(38) is the last one 128 bit could multiply by 55 bit
+ */
+static inline bool fp64_fixed_pow5_inline(int e, unsigned __int128 * _Nonnull power) {
+    const int table_max = (int)ARRAY_SIZE(base10_power_uint64) - 1;
+    DEBUG_ASSERT(e >= 0);
+    if(e > 2 * table_max) return false;
+    int high = e > table_max ? table_max : e;
+    power[0] = (unsigned __int128)(base10_power_uint64[high] >> high) * (base10_power_uint64[e - high] >> (e - high));
+    return true;
+}
+
+/*!
+    @function fp64_fixed_round_128
+    @abstract output = significand x 2^(e2) x 10^(e10) rounded to nearest, ties to even
+    @return false if numerator or denominator does not fit 128 bit, or output does not fit 128 bit
+ */
+static bool fp64_fixed_round_128(uint64_t significand,
+                                 int e2,
+                                 int e10,
+                                 unsigned __int128 * _Nonnull output) {
+    unsigned __int128 numerator = significand;
+    unsigned __int128 power;
+    int two = e2 + e10;
+    
+    if(e10 > 0) {
+        if(!fp64_fixed_pow5_inline(e10, &power)) return false;
+        if(__builtin_mul_overflow(numerator, power, &numerator)) return false;
+    }
+    if(two > 0) {
+        if(two >= 128 || (numerator >> (128 - two)) != 0) return false;
+        numerator <<= two;
+    }
+    
+    unsigned __int128 quotient, remainder, half;
+    if(e10 >= 0) {
+        // denominator 2^(-two), shift only
+        int shift = two < 0 ? - two : 0;
+        if(shift >= 128) {
+            quotient = 0;
+            remainder = numerator;
+            half = shift == 128 ? (unsigned __int128)1 << 127 : ~(unsigned __int128)0;
+        }
+        else if(shift > 0) {
+            quotient = numerator >> shift;
+            remainder = numerator & (((unsigned __int128)1 << shift) - 1);
+            half = (unsigned __int128)1 << (shift - 1);
+        }
+        else {
+            quotient = numerator;
+            remainder = 0;
+            half = 1;
+        }
+        if(remainder > half || (remainder == half && (quotient & 1))) {
+            if(quotient == ~(unsigned __int128)0) return false;
+            quotient++;
+        }
+    }
+    else {
+        unsigned __int128 denominator;
+        if(!fp64_fixed_pow5_inline(- e10, &denominator)) return false;
+        if(two < 0) {
+            if(- two >= 128 || (denominator >> (128 + two)) != 0) return false;
+            denominator <<= - two;
+        }
+        quotient = numerator / denominator;
+        remainder = numerator % denominator;
+        // 2 x remainder against denominator without overflow
+        if(remainder > denominator - remainder || (remainder == denominator - remainder && (quotient & 1))) quotient++;
+    }
+    
+    output[0] = quotient;
+    return true;
+}
+
+/*!
+    @function fp64_fixed_round_extended
+    @abstract same as fp64_fixed_round_128 for exponent far from zero, one extended_integer division
+    @param significand_high significand bits above the lowest 64 bit [binary 128], zero otherwise
+    @return false if output does not fit 128 bit or scratch arena is full
+ */
+static bool fp64_fixed_round_extended(uint64_t significand,
+                                      uint64_t significand_high,
+                                      int e2,
+                                      int e10,
+                                      unsigned __int128 * _Nonnull output) {
+    SCRATCH_ARENA_SCOPE;
+    int two = e2 + e10;
+    
+    // 5^(k) is less than 2^(7k / 3)
+    size_t numerator_bit = (significand_high != 0 ? 128 : 64) + (two > 0 ? two : 0) + (e10 > 0 ? (7 * e10 + 2) / 3 : 0);
+    size_t denominator_bit = 1 + (two < 0 ? - two : 0) + (e10 < 0 ? (- 7 * e10 + 2) / 3 : 0);
+    // one more bit for 2 x remainder, at least 128 bit to read the quotient
+    size_t bit = (numerator_bit > denominator_bit ? numerator_bit : denominator_bit) + 1;
+    size_t length = EXT_ARRAY_SIZE_FOR_BIT(bit > 128 ? bit : 128);
+    
+    EXT_ARRAY numerator = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+    EXT_ARRAY denominator = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+    EXT_ARRAY temp = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+    if(numerator == NULL || denominator == NULL || temp == NULL) DEBUG_RETURN(false);
+    
+    bool error_flag;
+    extended_integer_initialize(numerator, length);
+    extended_integer_set_uint64(numerator, length, 0, significand);
+    extended_integer_set_uint64(numerator, length, 64, significand_high);
+    
+    if(e10 > 0) {
+        extended_integer_pow_uint32(5, (uint32_t)e10, temp, length, &error_flag);
+        if(error_flag) DEBUG_RETURN(false);
+        extended_integer_multiply(numerator, temp, denominator, length, &error_flag);
+        if(error_flag) DEBUG_RETURN(false);
+        extended_integer_copy(denominator, numerator, length);
+    }
+    extended_integer_pow_uint32(5, (uint32_t)(e10 < 0 ? - e10 : 0), denominator, length, &error_flag);
+    if(error_flag) DEBUG_RETURN(false);
+    
+    if(two > 0) {
+        extended_integer_bit_offset(numerator, temp, length, two);
+        extended_integer_copy(temp, numerator, length);
+    }
+    else if(two < 0) {
+        extended_integer_bit_offset(denominator, temp, length, - two);
+        extended_integer_copy(temp, denominator, length);
+    }
+    
+    // temp = numerator / denominator, numerator = numerator % denominator
+    extended_integer_divide_modulo(numerator, denominator, temp, numerator, length, &error_flag);
+    if(error_flag) DEBUG_RETURN(false);
+    if(extended_integer_bit_length(temp, length) > 128) return false;
+    
+    unsigned __int128 quotient = 0;
+    for(size_t index = EXT_ARRAY_SIZE_FOR_BIT(128); index > 0; index--)
+        quotient = (quotient << EXT_BIT) | temp[index - 1];
+    
+    extended_integer_add(numerator, numerator, temp, length, &error_flag);
+    int compare = extended_integer_compare(temp, denominator, length);
+    if(compare > 0 || (compare == 0 && (quotient & 1))) {
+        if(quotient == ~(unsigned __int128)0) return false;
+        quotient++;
+    }
+    output[0] = quotient;
+    return true;
+}
+
+/*!
+    @function fp64_fixed_prepare_digits_inline
+    @abstract same as floating_point_base_convert_prepare_digits_inline for value up to 38 digits, split at 10^(19)
+ */
+static inline bool fp64_fixed_prepare_digits_inline(fpbc_ref _Nonnull fpbc,
+                                                    unsigned __int128 value,
+                                                    long exponent) {
+    if(value <= UINT64_MAX) return floating_point_base_convert_prepare_digits_inline(fpbc, (uint64_t)value, exponent);
+    
+    const unsigned int low_amount = (unsigned int)ARRAY_SIZE(base10_power_uint64) - 1;
+    unsigned __int128 high = value / base10_power_uint64[low_amount];
+    uint64_t low = (uint64_t)(value % base10_power_uint64[low_amount]);
+    if(high > UINT64_MAX) return false;     // beyond FP64_FIXED_DIGITS_MAX
+    if(!floating_point_base_convert_prepare_digits_inline(fpbc, (uint64_t)high, exponent + low_amount)) return false;
+    if(fpbc->digits_amount + low_amount > ARRAY_SIZE(fpbc->digits_storage)) DEBUG_RETURN(false);
+    
+    for(unsigned int index = fpbc->digits_amount + low_amount; index > fpbc->digits_amount; index--, low /= 10)
+        fpbc->digits[index - 1] = (uint8_t)(low % 10);
+    fpbc->digits_amount += low_amount;
+    return true;
+}
+
+/*!
+    @function printf_output_specifier_floating_point_fpbc_prepare_fixed
+    @abstract fill fpbc with [fFeE] digits of binary 64 [80 bit or binary 128] already rounded to precision, no rounding left for the specifier
+    @return false if not handled here [ precision, specifier or digits amount out of range ], fpbc is untouched then
+ */
+static bool printf_output_specifier_floating_point_fpbc_prepare_fixed(printf_interprate_ref _Nonnull interprate,
+                                                                      fp_info_ref _Nonnull info,
+                                                                      fpbc_ref _Nonnull fpbc) {
+    if(interprate != NULL && info != NULL && fpbc != NULL) {
+        // significand of 80 bit takes all 64 bit with integer bit, binary 128 takes 49 bit more
+        size_t significand_bit_amount = floating_point_info_query_significand_bit_amount_inline(info);
+        size_t precision_max = significand_bit_amount >= 64 ? FP128_FIXED_PRECISION_MAX :
+                               significand_bit_amount >= FP80_SIGNIFICAND_BIT ? FP80_FIXED_PRECISION_MAX : FP64_FIXED_PRECISION_MAX;
+        if(interprate->precision > precision_max) return false;
+        int precision = (int)interprate->precision;
+        
+        uint64_t significand = floating_point_info_query_significand_inline(info);
+        uint64_t significand_high = floating_point_info_query_significand_high_inline(info);
+        unsigned int raw_exponent = floating_point_info_query_raw_exponent_inline(info);
+        int e2 = (int)raw_exponent - (int)floating_point_query_exponent_base(info) - (int)significand_bit_amount;
+        if(raw_exponent > 0) {
+            if(significand_bit_amount >= 64) significand_high |= UINT64_C(1) << (significand_bit_amount - 64);
+            else significand |= UINT64_C(1) << significand_bit_amount;
+        }
+        else e2 += 1;
+        if(significand == 0 && significand_high == 0) DEBUG_RETURN(false);
+        
+        int bit_exponent = e2 + (significand_high != 0 ?
+                                 127 - __builtin_clzll(significand_high) :
+                                 63 - __builtin_clzll(significand));
+        
+        unsigned __int128 value;
+        long exponent;
+        switch (interprate->type) {
+            case printf_specifier_f:
+            case printf_specifier_F:
+                // digits beyond 128 bit are left to exact digits of extended_integer
+                if(significand_high == 0) {
+                    if(!fp64_fixed_round_128(significand, e2, precision, &value)) return false;
+                }
+                else {
+                    // 10^(p) is at least 2^(3p)
+                    if(bit_exponent + 3 * precision >= 128) return false;
+                    if(!fp64_fixed_round_extended(significand, significand_high, e2, precision, &value)) return false;
+                }
+                exponent = - precision;
+                break;
+            case printf_specifier_e:
+            case printf_specifier_E: {
+                // floor(log10(v)) or one less, same log10(2) as the scale estimate
+                int e10 = (int)(((int64_t)bit_exponent * INT64_C(1292913986)) >> 32);
+                unsigned __int128 limit;
+                fp64_fixed_pow5_inline(precision + 1, &limit);
+                limit <<= precision + 1;
+                for(int count = 0; count < 2; count++) {
+                    if(!(significand_high == 0 && fp64_fixed_round_128(significand, e2, precision - e10, &value)) &&
+                       !fp64_fixed_round_extended(significand, significand_high, e2, precision - e10, &value)) DEBUG_RETURN(false);
+                    if(value <= limit) break;
+                    e10++;      // estimate was one less
+                }
+                DEBUG_ASSERT(value <= limit);
+                if(value == limit) {
+                    value /= 10;    // 9.99 rounded to 10.0
+                    e10++;
+                }
+                exponent = e10 - precision;
+            }   break;
+            default: return false;
+        }
+        
+        return fp64_fixed_prepare_digits_inline(fpbc, value, exponent);
+    } DEBUG_ELSE
+    return false;
+}
+
+#endif
+
+#pragma mark floating point exact digits [binary 32]
+
+/*!
+    @function fp32_exact_divide_10_inline
+    @abstract limbs = limbs / 10 [most significant limb last]
+    @return remainder
+ */
+static inline uint32_t fp32_exact_divide_10_inline(uint32_t * _Nonnull limbs, size_t amount) {
+    uint64_t remainder = 0;
+    for(size_t index = amount; index > 0; index--) {
+        uint64_t current = (remainder << 32) | limbs[index - 1];
+        limbs[index - 1] = (uint32_t)(current / 10);
+        remainder = current % 10;
+    }
+    return (uint32_t)remainder;
+}
+
+/*!
+    @function fp32_exact_digits
+    @abstract every decimal digit of [significand x 2^(e2)], most significant first, 64 bit arithmetic only
+    @param significand binary 32 significand with implicit one, not zero
+    @param exponent value is 0.[digits] x 10^(exponent)
+    @return digits amount, zero if significand is zero or e2 is out of binary 32 range
+ */
+static unsigned int fp32_exact_digits(uint32_t significand,
+                                      int e2,
+                                      uint8_t * _Nonnull digits,
+                                      long * _Nonnull exponent) {
+    if(significand == 0 || significand >> (FP32_SIGNIFICAND_BIT + 1) != 0 || e2 < - 149 || e2 > 104) return 0;
+    
+    uint32_t limbs[FP32_EXACT_LIMB_AMOUNT] = { 0 };
+    int shift = e2 < 0 ? - e2 : 0;
+    unsigned int amount = 0;
+    
+    // integer part, digits come out least significant first
+    uint32_t integer = 0;
+    if(e2 >= 0) {
+        uint64_t wide = (uint64_t)significand << (e2 & 31);
+        limbs[e2 / 32] = (uint32_t)wide;
+        limbs[e2 / 32 + 1] = (uint32_t)(wide >> 32);
+    }
+    else if(shift < 32) integer = significand >> shift;
+    if(e2 >= 0 || integer != 0) {
+        if(e2 < 0) limbs[0] = integer;
+        bool nonzero = true;
+        while(nonzero) {
+            DEBUG_ASSERT(amount < FP32_EXACT_DIGITS_MAX);
+            digits[amount++] = (uint8_t)fp32_exact_divide_10_inline(limbs, FP32_EXACT_LIMB_AMOUNT);
+            nonzero = false;
+            for(size_t index = 0; index < FP32_EXACT_LIMB_AMOUNT; index++) nonzero |= limbs[index] != 0;
+        }
+        for(unsigned int index = 0; index < amount / 2; index++) {
+            uint8_t temp = digits[index];
+            digits[index] = digits[amount - 1 - index];
+            digits[amount - 1 - index] = temp;
+        }
+    }
+    exponent[0] = amount;
+    if(e2 >= 0) return amount;
+    
+    // fraction part over 2^(shift), each digit is the bits from shift after times 10
+    limbs[0] = shift < 32 ? significand & ((UINT32_C(1) << shift) - 1) : significand;
+    for(size_t index = 1; index < FP32_EXACT_LIMB_AMOUNT; index++) limbs[index] = 0;
+    size_t top = (size_t)shift / 32;
+    int offset = shift % 32;
+    bool nonzero = limbs[0] != 0;
+    while(nonzero) {
+        uint64_t carry = 0;
+        for(size_t index = 0; index <= top; index++) {
+            uint64_t current = (uint64_t)limbs[index] * 10 + carry;
+            limbs[index] = (uint32_t)current;
+            carry = current >> 32;
+        }
+        if(top + 1 < FP32_EXACT_LIMB_AMOUNT) limbs[top + 1] = (uint32_t)carry;
+        uint64_t window = limbs[top] | (top + 1 < FP32_EXACT_LIMB_AMOUNT ? (uint64_t)limbs[top + 1] << 32 : 0);
+        uint8_t digit = (uint8_t)(window >> offset);
+        limbs[top] &= offset > 0 ? (UINT32_C(1) << offset) - 1 : 0;
+        if(top + 1 < FP32_EXACT_LIMB_AMOUNT) limbs[top + 1] = 0;
+        
+        if(amount == 0 && digit == 0) exponent[0]--;        // leading zero of fraction
+        else {
+            DEBUG_ASSERT(amount < FP32_EXACT_DIGITS_MAX);
+            digits[amount++] = digit;
+        }
+        nonzero = false;
+        for(size_t index = 0; index <= top; index++) nonzero |= limbs[index] != 0;
+    }
+    return amount;
+}
+
+/*!
+    @function printf_output_specifier_floating_point_fpbc_prepare_exact
+    @abstract fill fpbc with [fFeEgG] digits of binary 32 rounded from all its exact digits, ties to even
+    @discussion any precision, digits past the exact ones are zero, so no rounding is left for the specifier
+    @return false if not binary 32, fpbc is untouched then
+ */
+static bool printf_output_specifier_floating_point_fpbc_prepare_exact(printf_interprate_ref _Nonnull interprate,
+                                                                      fp_info_ref _Nonnull info,
+                                                                      fpbc_ref _Nonnull fpbc) {
+    if(interprate != NULL && info != NULL && fpbc != NULL) {
+        if(info->type != IEEE754_type_32) return false;
+        
+        uint32_t significand = floating_point_info_query_significand_32_inline(info);
+        unsigned int raw_exponent = floating_point_info_query_raw_exponent_inline(info);
+        int e2 = (int)raw_exponent - FP32_EXPONENT_BASE - FP32_SIGNIFICAND_BIT;
+        if(raw_exponent > 0) significand |= UINT32_C(1) << FP32_SIGNIFICAND_BIT;
+        else e2 += 1;
+        
+        long exponent;
+        fpbc->digits = fpbc->digits_storage;
+        unsigned int amount = fp32_exact_digits(significand, e2, fpbc->digits, &exponent);
+        if(amount == 0) DEBUG_RETURN(false);
+        
+        return floating_point_base_convert_round_digits(interprate, fpbc, amount, exponent, false);
+    } DEBUG_ELSE
+    return false;
+}
+
+/*!
+    @function floating_point_base_convert_exact_digit_inline
+    @abstract next digit of remain / scale, the whole remainder is kept [ no shortest stop ]
+ */
+static inline bool floating_point_base_convert_exact_digit_inline(fpbc_ref _Nonnull fpbc,
+                                                                  size_t length,
+                                                                  uint8_t * _Nonnull digit) {
+    bool error_flag;
+    extended_integer_quick_multiply(fpbc->remain, fpbc->base_value, length, &error_flag);
+    if(error_flag) DEBUG_RETURN(false);
+    EXT_TYPE current = extended_integer_quick_divide_modulo(fpbc->remain, fpbc->scale, length, &error_flag);
+    if(error_flag || current > 9) DEBUG_RETURN(false);
+    digit[0] = (uint8_t)current;
+    return true;
+}
+
+/*!
+    @function printf_output_specifier_floating_point_fpbc_prepare_exact_extended
+    @abstract fill fpbc with [fFeEgG] digits rounded from remain / scale after simple fix up, ties to even
+    @discussion any type and precision, digits are divided out until the one after the kept digits,
+                the remainder left is the sticky bit
+                simple fix up may take one more exponent for (v + v(+)) / 2, that leading zero is dropped
+ */
+static bool printf_output_specifier_floating_point_fpbc_prepare_exact_extended(printf_interprate_ref _Nonnull interprate,
+                                                                               fpbc_ref _Nonnull fpbc) {
+    if(interprate != NULL && fpbc != NULL) {
+        size_t length = fpbc->active_length;
+        long exponent = fpbc->exponent;
+        
+        uint8_t digit;
+        if(!floating_point_base_convert_exact_digit_inline(fpbc, length, &digit)) DEBUG_RETURN(false);
+        if(digit == 0) {
+            exponent--;
+            if(!floating_point_base_convert_exact_digit_inline(fpbc, length, &digit)) DEBUG_RETURN(false);
+        }
+        DEBUG_ASSERT(digit != 0);
+        
+        long keep;
+        if(!floating_point_base_convert_digits_kept_inline(interprate, exponent, &keep)) DEBUG_RETURN(false);
+        long wanted = keep > 0 ? keep + 1 : 1;     // one more to round
+        if(wanted > PRINTF_SCRATCH_ALLOCATION_LIMIT) DEVELOP_BREAKPOINT_RETURN(false);
+        
+        // allocated in scope of the caller, queried by the specifier after
+        fpbc->digits = fpbc->digits_storage;
+        if(wanted > (long)ARRAY_SIZE(fpbc->digits_storage)) {
+            fpbc->digits = printf_scratch_alloc(sizeof(uint8_t) * (size_t)wanted);
+            if(fpbc->digits == NULL) DEBUG_RETURN(false);
+        }
+        
+        unsigned int amount = 0;
+        fpbc->digits[amount++] = digit;
+        bool sticky = extended_integer_used_length(fpbc->remain, length) > 0;
+        while(sticky && amount < (unsigned int)wanted) {
+            if(!floating_point_base_convert_exact_digit_inline(fpbc, length, &fpbc->digits[amount++])) DEBUG_RETURN(false);
+            sticky = extended_integer_used_length(fpbc->remain, length) > 0;
+        }
+        
+        return floating_point_base_convert_round_digits(interprate, fpbc, amount, exponent, sticky);
+    } DEBUG_ELSE
+    return false;
+}
+
+#pragma mark floating point subnormal types
+
+typedef struct printf_floating_point_zero_pure_data {
+    size_t pure_width;
+    bool has_decimal_point;     // [aA] only, # is taken by the 0x prefix
+} printf_floating_point_zero_pure_data_t;
+
+typedef printf_floating_point_zero_pure_data_t * printf_floating_point_zero_pure_data_ref;
+
+static bool printf_floating_point_zero_pure_function(printf_core_ref _Nonnull core,
+                                                     printf_interprate_ref _Nonnull interprate,
+                                                     size_t pure_width,
+                                                     void * _Nonnull input);
+
+static bool printf_output_specifier_floating_point_zero(printf_core_ref _Nonnull core, printf_interprate_ref _Nonnull interprate, fp_info_ref _Nonnull info) {
+    if(core != NULL && interprate != NULL && info != NULL && printf_specifier_type_is_floating_point_inline(interprate->type)) {
+        
+        DEBUG_ASSERT(interprate->width_type != printf_interprate_adjustment_waiting_input);
+        DEBUG_ASSERT(interprate->precision_type != printf_interprate_adjustment_waiting_input);
+        
+        size_t pure_width = 0;
+        bool has_decimal_point = false;
+        printf_complex_prefix complex_prefix = printf_complex_prefix_none;
+        
+        switch (interprate->type) {
+            case printf_specifier_f:
+            case printf_specifier_F:
+                pure_width += 1;        // 0
+                if(interprate->precision > 0)
+                    pure_width += interprate->precision + 1;        // .xxx
+                else if(interprate->flag & printf_interprate_flag_complex)
+                    pure_width += 1;                                // .
+                break;
+            case printf_specifier_e:
+            case printf_specifier_E:
+                pure_width += 1;        // 0
+                if(interprate->precision > 0)
+                    pure_width += interprate->precision + 1;        // .xxx
+                else if(interprate->flag & printf_interprate_flag_complex)
+                    pure_width += 1;                                // .
+                pure_width += 4;                                    // (e/E)+00
+                break;
+            case printf_specifier_g:
+            case printf_specifier_G:
+                // must be in %f style format, # keeps P - 1 zeros after the decimal point
+                pure_width += 1;        // 0
+                if(interprate->flag & printf_interprate_flag_complex) {
+                    pure_width += 1;                                // .
+                    if(interprate->precision > 1)
+                        pure_width += interprate->precision - 1;    // xxx
+                }
+                break;
+            case printf_specifier_a:
+            case printf_specifier_A:
+                pure_width += 1;        // 0, 0x prefix is put before zero padding
+                if(interprate->precision_type == printf_interprate_adjustment_unspecified)
+                    interprate->precision = 0;
+                has_decimal_point = interprate->precision > 0 || (interprate->flag & printf_interprate_flag_complex);
+                if(has_decimal_point)
+                    pure_width += interprate->precision + 1;        // .xxx
+                pure_width += 3;        // p+0
+                complex_prefix = interprate->type == printf_specifier_a ? printf_complex_prefix_0x : printf_complex_prefix_0X;
+                interprate->flag |= printf_interprate_flag_complex;
+                break;
+            case printf_specifier_invalid:
+            default: DEBUG_RETURN(false);
+        }
+        
+        printf_floating_point_zero_pure_data_t pure_data_store;
+        printf_floating_point_zero_pure_data_ref pure_data = &pure_data_store;
+        pure_data->pure_width = pure_width;
+        pure_data->has_decimal_point = has_decimal_point;
+        
+        bool is_floating_negative = floating_point_info_query_sign_bit_inline(info);
+        
+        return printf_core_output_flag_width_help(core,
+                                                  interprate,
+                                                  pure_width,
+                                                  complex_prefix,
+                                                  is_floating_negative,
+                                                  printf_floating_point_zero_pure_function,
+                                                  pure_data);
+    } DEBUG_ELSE
+    return false;
+}
+
+static bool printf_floating_point_zero_pure_function(printf_core_ref _Nonnull core,
+                                                     printf_interprate_ref _Nonnull interprate,
+                                                     size_t pure_width,
+                                                     void * _Nonnull input) {
+    if(core != NULL && interprate != NULL && input != NULL) {
+        printf_floating_point_zero_pure_data_ref pure_data = (printf_floating_point_zero_pure_data_ref)input;
+        if(pure_data->pure_width == pure_width) {
+            switch (interprate->type) {
+                case printf_specifier_f:
+                case printf_specifier_F:
+                    printf_core_output_character(core, CHARACTER_0);
+                    if(interprate->precision > 0) {
+                        printf_core_output_character(core, CHARACTER_dot);
+                        printf_core_output_fill(core, CHARACTER_0, interprate->precision);
                     }
                     else if(interprate->flag & printf_interprate_flag_complex)
                         printf_core_output_character(core, CHARACTER_dot);
@@ -2866,8 +4522,7 @@ static bool printf_floating_point_zero_pure_function(printf_core_ref _Nonnull co
                     printf_core_output_character(core, CHARACTER_0);
                     if(interprate->precision > 0) {
                         printf_core_output_character(core, CHARACTER_dot);
-                        for(size_t index = 0; index < interprate->precision; index++)
-                            printf_core_output_character(core, CHARACTER_0);
+                        printf_core_output_fill(core, CHARACTER_0, interprate->precision);
                     }
                     else if(interprate->flag & printf_interprate_flag_complex)
                         printf_core_output_character(core, CHARACTER_dot);
@@ -2882,25 +4537,20 @@ static bool printf_floating_point_zero_pure_function(printf_core_ref _Nonnull co
                 case printf_specifier_G:
                     // must be in %f style format
                     printf_core_output_character(core, CHARACTER_0);
-                    if(interprate->flag & printf_interprate_flag_complex)
+                    if(interprate->flag & printf_interprate_flag_complex) {
                         printf_core_output_character(core, CHARACTER_dot);
+                        if(interprate->precision > 1)
+                            printf_core_output_fill(core, CHARACTER_0, interprate->precision - 1);
+                    }
                     break;
                 case printf_specifier_a:
                 case printf_specifier_A:
-                    pure_width += 3;        // 0x0
-                    printf_core_output_character(core, CHARACTER_0);
-                    if(interprate->type == printf_specifier_a)
-                        printf_core_output_character(core, CHARACTER_x);
-                    else printf_core_output_character(core, CHARACTER_X);
                     printf_core_output_character(core, CHARACTER_0);
                     DEBUG_ASSERT(interprate->precision_type != printf_interprate_adjustment_unspecified || interprate->precision == 0);
-                    if(interprate->precision > 0) {
+                    if(pure_data->has_decimal_point) {
                         printf_core_output_character(core, CHARACTER_dot);
-                        for(size_t index = 0; index < interprate->precision; index++)
-                            printf_core_output_character(core, CHARACTER_0);
+                        printf_core_output_fill(core, CHARACTER_0, interprate->precision);
                     }
-                    else if(interprate->flag & printf_interprate_flag_complex)
-                        printf_core_output_character(core, CHARACTER_dot);
                     if(interprate->type == printf_specifier_a)
                         printf_core_output_character(core, CHARACTER_p);
                     else printf_core_output_character(core, CHARACTER_P);
@@ -2939,17 +4589,12 @@ static bool printf_output_specifier_floating_point_inf(printf_core_ref _Nonnull
         
         if(floating_point_info_query_sign_bit_inline(info)) {
             if(core->type == printf_type_FILE) {
-                if(core->output.file != NULL) {
-                    putc(CHARACTER_minus, core->output.file);
-                } DEBUG_ELSE
+                printf_core_file_put_inline(core, CHARACTER_minus);
             }
             else if(core->type == printf_type_string) {
-                if(core->output.string.store != NULL && core->output.string.index + 1 < core->output.string.count) {
-                    DEBUG_ASSERT(core->output.string.store[core->output.string.index] == CHARACTER_null);
-                    
-                    core->output.string.store[core->output.string.index] = CHARACTER_minus;
-                    core->output.string.store[core->output.string.index + 1] = CHARACTER_null;
-                    core->output.string.index += 1;
+                if(core->output.string.remain > 0) {
+                    core->output.string.store[core->output.string.index++] = CHARACTER_minus;
+                    core->output.string.remain--;
                 }
             } ELSE_DEBUG_RETURN(false);
             core->actual_need += 1;
@@ -2990,6 +4635,7 @@ static bool printf_output_specifier_floating_point_specifier_fF(printf_core_ref
                                                                 fp_info_ref _Nonnull info,
                                                                 fpbc_ref _Nonnull fpbc) {
     if(core != NULL && interprate != NULL && info != NULL && fpbc != NULL) {
+        SCRATCH_ARENA_SCOPE;
         
         DEBUG_ASSERT(interprate->type == printf_specifier_f || interprate->type == printf_specifier_F);
         
@@ -3016,15 +4662,16 @@ static bool printf_output_specifier_floating_point_specifier_fF(printf_core_ref
         right_abs = interprate->precision;
         
         size_t allocated_size;
-        if(left > PRINTF_STACK_ALLOCATION_LIMIT || right_abs > PRINTF_STACK_ALLOCATION_LIMIT)
+        if(left > PRINTF_SCRATCH_ALLOCATION_LIMIT || right_abs > PRINTF_SCRATCH_ALLOCATION_LIMIT)
             DEVELOP_BREAKPOINT_RETURN(false);
             // [BREAKPOINT] this is too large to parsing
-        if((allocated_size = left + right_abs + 2) > PRINTF_STACK_ALLOCATION_LIMIT)
+        if((allocated_size = left + right_abs + 2) > PRINTF_SCRATCH_ALLOCATION_LIMIT)
             DEVELOP_BREAKPOINT_RETURN(false);
             // [BREAKPOINT] this is too large to parsing
         
         DEBUG_ASSERT(UCHAR_MAX >= fpbc->base_value && UCHAR_MAX >= 9u);
-        unsigned char *significand = printf_stack_alloc(sizeof(unsigned char) * allocated_size);
+        unsigned char *significand = printf_scratch_alloc(sizeof(unsigned char) * allocated_size);
+        if(significand == NULL) DEBUG_RETURN(false);
         
         size_t left_index = 1;
         size_t zero_index = left_index + left;
@@ -3174,6 +4821,7 @@ static bool printf_output_specifier_floating_point_specifier_eE(printf_core_ref
                                                                 fp_info_ref _Nonnull info,
                                                                 fpbc_ref _Nonnull fpbc) {
     if(core != NULL && interprate != NULL && info != NULL && fpbc != NULL) {
+        SCRATCH_ARENA_SCOPE;
         
         DEBUG_ASSERT(interprate->type == printf_specifier_e || interprate->type == printf_specifier_E);
         
@@ -3188,34 +4836,17 @@ static bool printf_output_specifier_floating_point_specifier_eE(printf_core_ref
         if(interprate->precision == 0 && !(interprate->flag & printf_interprate_flag_complex))
             need_decimal_point = false;
         
-        if(interprate->precision > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
+        if(interprate->precision > PRINTF_SCRATCH_ALLOCATION_LIMIT) DEBUG_RETURN(false);
         size_t allocated_size = interprate->precision + 2;  // [oveflow]9.1234
-        if(allocated_size > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
+        if(allocated_size > PRINTF_SCRATCH_ALLOCATION_LIMIT) DEBUG_RETURN(false);
         
         long first_exponent = exponent;
-        long first_exponent_abs = first_exponent;
-        bool first_exponent_negative = false;
-        if(first_exponent_abs < 0) {
-            first_exponent_negative = true;
-            first_exponent_abs = - first_exponent_abs;
-        }
-        
-        size_t first_exponent_pure_width = 1;
-        for(long temp = first_exponent_abs; (temp /= 10) > 0;)
-            first_exponent_pure_width++;
-        
-        // not possible to happen
-        if(first_exponent_pure_width > PRINTF_INTEGER_MAX_DIGITS_AMOUNT) DEBUG_RETURN(false);
-        
-        size_t first_exponent_need_width = 2;
-        if(first_exponent_pure_width > first_exponent_need_width)
-            first_exponent_need_width = first_exponent_pure_width;
-        
-        size_t first_index = 1;
-        size_t last_index = interprate->precision + 1;
+        size_t first_index = 1;
+        size_t last_index = interprate->precision + 1;
         
         DEBUG_ASSERT(UCHAR_MAX >= fpbc->base_value && UCHAR_MAX >= 9u);
-        unsigned char *significand = printf_stack_alloc(sizeof(unsigned char) * allocated_size);
+        unsigned char *significand = printf_scratch_alloc(sizeof(unsigned char) * allocated_size);
+        if(significand == NULL) DEBUG_RETURN(false);
         
         for(size_t index = first_index; index < last_index; index++) {
             long current_exponent = first_exponent - (index - first_index);
@@ -3273,12 +4904,31 @@ static bool printf_output_specifier_floating_point_specifier_eE(printf_core_ref
                     significand[first_index] = 0;
                     significand[0] = 1;
                     first_index = 0;
+                    first_exponent += 1;    // 9.99 rounded to 10.0
                     last_index -= 1;    // last could not round again
                 }
                 else significand[first_index] += 1;
             }
         }
         
+        long first_exponent_abs = first_exponent;
+        bool first_exponent_negative = false;
+        if(first_exponent_abs < 0) {
+            first_exponent_negative = true;
+            first_exponent_abs = - first_exponent_abs;
+        }
+        
+        size_t first_exponent_pure_width = 1;
+        for(long temp = first_exponent_abs; (temp /= 10) > 0;)
+            first_exponent_pure_width++;
+        
+        // not possible to happen
+        if(first_exponent_pure_width > PRINTF_INTEGER_MAX_DIGITS_AMOUNT) DEBUG_RETURN(false);
+        
+        size_t first_exponent_need_width = 2;
+        if(first_exponent_pure_width > first_exponent_need_width)
+            first_exponent_need_width = first_exponent_pure_width;
+        
         size_t pure_width = last_index - first_index + 1;
         if(need_decimal_point) pure_width += 1;
         pure_width += 2;        // e+
@@ -3313,6 +4963,7 @@ static bool printf_specifier_e_pure_function(printf_core_ref _Nonnull core,
                                              size_t pure_width,
                                              void * _Nonnull input) {
     if(core != NULL && interprate != NULL && input != NULL) {
+        SCRATCH_ARENA_SCOPE;
         printf_specifier_e_pure_data_ref pure_data = (printf_specifier_e_pure_data_ref)input;
         DEBUG_ASSERT(pure_data->pure_width == pure_width);
         if(pure_data->significand != NULL && pure_data->pure_width == pure_width) {
@@ -3337,11 +4988,11 @@ static bool printf_specifier_e_pure_function(printf_core_ref _Nonnull core,
                 printf_core_output_character(core, CHARACTER_minus);
             else printf_core_output_character(core, CHARACTER_plus);
             if(pure_data->first_exponent_need_width > pure_data->first_exponent_pure_width)
-                for(size_t index = 0; index < (pure_data->first_exponent_need_width - pure_data->first_exponent_pure_width); index++)
-                    printf_core_output_character(core, CHARACTER_0);
+                printf_core_output_fill(core, CHARACTER_0, pure_data->first_exponent_need_width - pure_data->first_exponent_pure_width);
             DEBUG_ASSERT(UCHAR_MAX >= 9u);
             DEBUG_ASSERT(pure_data->first_exponent_pure_width >= 1);
-            unsigned char *exponent_value = printf_stack_alloc(sizeof(unsigned char) * pure_data->first_exponent_pure_width);
+            unsigned char *exponent_value = printf_scratch_alloc(sizeof(unsigned char) * pure_data->first_exponent_pure_width);
+            if(exponent_value == NULL) DEBUG_RETURN(false);
             long temp = pure_data->first_exponent_abs;
             size_t index = 0;
             do {
@@ -3369,6 +5020,7 @@ static bool printf_output_specifier_floating_point_specifier_gG_f_form(printf_co
                                                                        fp_info_ref _Nonnull info,
                                                                        fpbc_ref _Nonnull fpbc) {
     if(core != NULL && interprate != NULL && info != NULL && fpbc != NULL) {
+        SCRATCH_ARENA_SCOPE;
         
         DEBUG_ASSERT(interprate->type == printf_specifier_g || interprate->type == printf_specifier_G);
         
@@ -3417,15 +5069,16 @@ static bool printf_output_specifier_floating_point_specifier_gG_f_form(printf_co
         }
         
         size_t allocated_size;
-        if(left > PRINTF_STACK_ALLOCATION_LIMIT || right_abs > PRINTF_STACK_ALLOCATION_LIMIT)
+        if(left > PRINTF_SCRATCH_ALLOCATION_LIMIT || right_abs > PRINTF_SCRATCH_ALLOCATION_LIMIT)
             DEVELOP_BREAKPOINT_RETURN(false);
             // [BREAKPOINT] this is too large to parsing
-        if((allocated_size = left + right_abs + 2) > PRINTF_STACK_ALLOCATION_LIMIT)
+        if((allocated_size = left + right_abs + 2) > PRINTF_SCRATCH_ALLOCATION_LIMIT)
             DEVELOP_BREAKPOINT_RETURN(false);
             // [BREAKPOINT] this is too large to parsing
         
         DEBUG_ASSERT(UCHAR_MAX >= fpbc->base_value && UCHAR_MAX >= 9u);
-        unsigned char *significand = printf_stack_alloc(sizeof(unsigned char) * allocated_size);
+        unsigned char *significand = printf_scratch_alloc(sizeof(unsigned char) * allocated_size);
+        if(significand == NULL) DEBUG_RETURN(false);
         
         size_t left_index = 1;
         size_t zero_index = left_index + left;
@@ -3449,6 +5102,13 @@ static bool printf_output_specifier_floating_point_specifier_gG_f_form(printf_co
                     if(!check_flag) DEBUG_RETURN(false);
                     DEBUG_ASSERT(exponent == current_exponent);
                 }
+                else if(interprate->flag & printf_interprate_flag_complex) {
+                    // # keeps the trailing zero
+                    form_well = true;
+                    for(size_t loop = index; loop <= right_index; loop++)
+                        significand[loop] = 0;
+                    break; // break exit for
+                }
                 else {
                     // quick finish
                     form_well = true;
@@ -3524,8 +5184,8 @@ static bool printf_output_specifier_floating_point_specifier_gG_f_form(printf_co
             }
         }
         
-        // get ride of trilling zero
-        while(right_index > zero_index)
+        // get ride of trilling zero, # keeps it
+        while(right_index > zero_index && !(interprate->flag & printf_interprate_flag_complex))
             if(significand[right_index] == 0)
                 right_index = right_index - 1;
             else break;
@@ -3565,6 +5225,7 @@ static bool printf_output_specifier_floating_point_specifier_gG_e_form(printf_co
                                                                        fp_info_ref _Nonnull info,
                                                                        fpbc_ref _Nonnull fpbc) {
     if(core != NULL && interprate != NULL && info != NULL && fpbc != NULL) {
+        SCRATCH_ARENA_SCOPE;
         
         DEBUG_ASSERT(interprate->type == printf_specifier_g || interprate->type == printf_specifier_G);
         
@@ -3578,34 +5239,17 @@ static bool printf_output_specifier_floating_point_specifier_gG_e_form(printf_co
         check_flag = floating_point_base_convert_query_next_digit(fpbc, &exponent, &value, &complete);
         if(!check_flag) DEBUG_RETURN(false);
         
-        if(interprate->precision > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
+        if(interprate->precision > PRINTF_SCRATCH_ALLOCATION_LIMIT) DEBUG_RETURN(false);
         size_t allocated_size = interprate->precision + 1;  // [oveflow]9.1234
-        if(allocated_size > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
+        if(allocated_size > PRINTF_SCRATCH_ALLOCATION_LIMIT) DEBUG_RETURN(false);
         
         long first_exponent = exponent;
-        long first_exponent_abs = first_exponent;
-        bool first_exponent_negative = false;
-        if(first_exponent_abs < 0) {
-            first_exponent_negative = true;
-            first_exponent_abs = - first_exponent_abs;
-        }
-        
-        size_t first_exponent_pure_width = 1;
-        for(long temp = first_exponent_abs; (temp /= 10) > 0;)
-            first_exponent_pure_width++;
-        
-        // not possible to happen
-        if(first_exponent_pure_width > PRINTF_INTEGER_MAX_DIGITS_AMOUNT) DEBUG_RETURN(false);
-        
-        size_t first_exponent_need_width = 2;
-        if(first_exponent_pure_width > first_exponent_need_width)
-            first_exponent_need_width = first_exponent_pure_width;
-        
         size_t first_index = 1;
         size_t last_index = interprate->precision;
         
         DEBUG_ASSERT(UCHAR_MAX >= fpbc->base_value && UCHAR_MAX >= 9u);
-        unsigned char *significand = printf_stack_alloc(sizeof(unsigned char) * allocated_size);
+        unsigned char *significand = printf_scratch_alloc(sizeof(unsigned char) * allocated_size);
+        if(significand == NULL) DEBUG_RETURN(false);
         
         bool form_well = false;
         
@@ -3618,6 +5262,13 @@ static bool printf_output_specifier_floating_point_specifier_gG_e_form(printf_co
                     if(!check_flag) DEBUG_RETURN(false);
                     DEBUG_ASSERT(current_exponent == exponent);
                 }
+                else if(interprate->flag & printf_interprate_flag_complex) {
+                    // # keeps the trailing zero
+                    form_well = true;
+                    for(size_t loop = index; loop <= last_index; loop++)
+                        significand[loop] = 0u;
+                    break; // break exit for
+                }
                 else {
                     // quick finish
                     form_well = true;
@@ -3677,6 +5328,7 @@ static bool printf_output_specifier_floating_point_specifier_gG_e_form(printf_co
                         significand[first_index] = 0;
                         significand[0] = 1;
                         first_index = 0;
+                        first_exponent += 1;    // 9.99 rounded to 10.0
                         last_index -= 1;    // last could not round again
                     }
                     else significand[first_index] += 1;
@@ -3684,8 +5336,26 @@ static bool printf_output_specifier_floating_point_specifier_gG_e_form(printf_co
             }
         }
         
-        // get ride of trilling zero
-        while(last_index > first_index)
+        long first_exponent_abs = first_exponent;
+        bool first_exponent_negative = false;
+        if(first_exponent_abs < 0) {
+            first_exponent_negative = true;
+            first_exponent_abs = - first_exponent_abs;
+        }
+        
+        size_t first_exponent_pure_width = 1;
+        for(long temp = first_exponent_abs; (temp /= 10) > 0;)
+            first_exponent_pure_width++;
+        
+        // not possible to happen
+        if(first_exponent_pure_width > PRINTF_INTEGER_MAX_DIGITS_AMOUNT) DEBUG_RETURN(false);
+        
+        size_t first_exponent_need_width = 2;
+        if(first_exponent_pure_width > first_exponent_need_width)
+            first_exponent_need_width = first_exponent_pure_width;
+        
+        // get ride of trilling zero, # keeps it
+        while(last_index > first_index && !(interprate->flag & printf_interprate_flag_complex))
             if(significand[last_index] == 0)
                 last_index = last_index - 1;
             else break;
@@ -3770,11 +5440,11 @@ static bool printf_output_specifier_floating_point_specifier_gG(printf_core_ref
 
 typedef struct printf_specifier_a_pure_data {
     size_t pure_width;
-    bool * _Nonnull significand_bit_data;
+    uint64_t fraction_high; // bits after first none zero bit, aligned to highest bit of high
+    uint64_t fraction_low;
+    unsigned int leading;   // 1 [0 of subnormal], one more if rounding carried over
     bool is_uppercase;
     bool has_decimal_point;
-    size_t index_after_first_none_zero;
-    size_t last_none_zero_index;
     bool is_exponent_negative;
     size_t exponent_abs;
     size_t exponent_digits;
@@ -3792,7 +5462,6 @@ static bool printf_output_specifier_floating_point_specifier_aA(printf_core_ref
                                                                 fp_info_ref _Nonnull info,
                                                                 bool is_normal) {
     if(core != NULL && interprate != NULL && info != NULL) {
-        
         DEBUG_ASSERT(interprate->type == printf_specifier_a || interprate->type == printf_specifier_A);
         
         DEBUG_ASSERT(interprate->width_type != printf_interprate_adjustment_waiting_input);
@@ -3807,34 +5476,43 @@ static bool printf_output_specifier_floating_point_specifier_aA(printf_core_ref
         unsigned int raw_exponent = floating_point_info_query_raw_exponent_inline(info);
         unsigned int exponent_base = floating_point_query_exponent_base(info);
         
-        size_t need_for_query_significand_bit =
-        floating_point_info_query_significand_bit(info, NULL, 0);
-        
-        // most impossible condition
-        if(need_for_query_significand_bit * sizeof(bool) >= PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
-        
-        bool *significand_bit_data = printf_stack_alloc(need_for_query_significand_bit * sizeof(bool) + 1);
-        floating_point_info_query_significand_bit(info, significand_bit_data + 1, need_for_query_significand_bit);
-        
-        if(is_normal) significand_bit_data[0] = true;
-        else significand_bit_data[0] = false;
-        
-        size_t significand_count = need_for_query_significand_bit + 1;
-        
-        size_t first_none_zero_index = 0;
-        while(first_none_zero_index < significand_count)
-            if(significand_bit_data[first_none_zero_index]) break;
-            else first_none_zero_index++;
-        
-        if(first_none_zero_index >= significand_count) DEBUG_RETURN(false);
+        size_t significand_bit_amount = floating_point_info_query_significand_bit_amount_inline(info);
+        uint64_t significand_low = floating_point_info_query_significand_inline(info);
+        uint64_t significand_high = floating_point_info_query_significand_high_inline(info);
+        if(is_normal) {
+            if(significand_bit_amount >= 64) significand_high |= UINT64_C(1) << (significand_bit_amount - 64);
+            else significand_low |= UINT64_C(1) << significand_bit_amount;
+        }
         
-        size_t last_none_zero_index = first_none_zero_index;
-        DEBUG_ASSERT(significand_count >= 1);
-        for(size_t index = significand_count - 1; index > first_none_zero_index; index--)
-            if(significand_bit_data[index]) { last_none_zero_index = index; break; }
+        if(significand_low == 0 && significand_high == 0) DEBUG_RETURN(false);
         
-        DEBUG_ASSERT(last_none_zero_index >= first_none_zero_index &&
-                     last_none_zero_index < significand_count);
+        // index 0 is the implicit bit, index significand_bit_amount is the lowest bit
+        size_t leading_zero = significand_high != 0 ? __builtin_clzll(significand_high) : 64 + __builtin_clzll(significand_low);
+        unsigned int leading = 1;
+        if(!is_normal) {
+            // subnormal is 0x0.xxx with the least normal exponent like glibc
+            leading = 0;
+            leading_zero = 127 - significand_bit_amount;
+            raw_exponent = 1;
+        }
+        DEBUG_ASSERT(128 - leading_zero <= significand_bit_amount + 1);
+        size_t first_none_zero_index = significand_bit_amount + 1 + leading_zero - 128;
+        
+        // drop first none zero bit, hex digits are taken from highest nibble
+        size_t shift = leading_zero + 1;
+        uint64_t fraction_high, fraction_low;
+        if(shift >= 128) {
+            fraction_high = 0;
+            fraction_low = 0;
+        }
+        else if(shift >= 64) {
+            fraction_high = significand_low << (shift - 64);
+            fraction_low = 0;
+        }
+        else {
+            fraction_high = (significand_high << shift) | (significand_low >> (64 - shift));
+            fraction_low = significand_low << shift;
+        }
         
         bool is_exponent_negative;
         size_t exponent_abs;
@@ -3853,43 +5531,59 @@ static bool printf_output_specifier_floating_point_specifier_aA(printf_core_ref
         temp = exponent_abs;
         while((temp /= 10) > 0) exponent_digits++;
         
+#ifdef PRINTF_FLOATING_POINT_SPECIFIER_A_UNSPECIFIED_PRECISION_OUTPUT_NEEDED
+        if(interprate->precision_type == printf_interprate_adjustment_unspecified) {
+            size_t re_precision = 0;
+            if(fraction_low != 0) re_precision = (128 - __builtin_ctzll(fraction_low) + 3) / 4;
+            else if(fraction_high != 0) re_precision = (64 - __builtin_ctzll(fraction_high) + 3) / 4;
+            interprate->precision = re_precision;
+        }
+#endif
+        
+        // round to precision hex digits, ties to even like glibc, the first significand is the last digit if none kept
+        if(interprate->precision < 32) {
+            size_t kept = interprate->precision * 4;
+            uint64_t round_bit, sticky, last_bit;
+            if(kept < 64) {
+                round_bit = (fraction_high >> (63 - kept)) & 1;
+                sticky = (fraction_high << kept << 1) | fraction_low;
+                last_bit = kept > 0 ? (fraction_high >> (64 - kept)) & 1 : leading & 1;
+                fraction_high = kept > 0 ? fraction_high >> (64 - kept) << (64 - kept) : 0;
+                fraction_low = 0;
+            }
+            else {
+                round_bit = (fraction_low >> (127 - kept)) & 1;
+                sticky = fraction_low << (kept - 64) << 1;
+                last_bit = kept > 64 ? (fraction_low >> (128 - kept)) & 1 : fraction_high & 1;
+                fraction_low = kept > 64 ? fraction_low >> (128 - kept) << (128 - kept) : 0;
+            }
+            if(round_bit && (sticky != 0 || last_bit)) {
+                // add one to the last kept digit
+                if(kept == 0) leading++;
+                else if(kept <= 64) {
+                    uint64_t one = UINT64_C(1) << (64 - kept);
+                    if((fraction_high += one) < one) leading++;
+                }
+                else {
+                    uint64_t one = UINT64_C(1) << (128 - kept);
+                    if((fraction_low += one) < one && ++fraction_high == 0) leading++;
+                }
+            }
+        }
+        
         size_t pure_width = 0;
         
-        pure_width += 1;    // 1 first significand
+        pure_width += 1;    // 1 first significand [0 or 2]
         
         bool has_decimal_point = false;
-        size_t index_after_first_none_zero = first_none_zero_index + 1;
         
-        if(index_after_first_none_zero <= last_none_zero_index)
+        if(interprate->precision > 0)
             has_decimal_point = true;
         else if(interprate->flag & printf_interprate_flag_complex)
             has_decimal_point = true;
         
         if(has_decimal_point) pure_width += 1;  // decimal point
         
-#ifdef PRINTF_FLOATING_POINT_SPECIFIER_A_UNSPECIFIED_PRECISION_OUTPUT_NEEDED
-        if(interprate->precision_type == printf_interprate_adjustment_unspecified) {
-            size_t re_precision = 0;
-            for(size_t index = index_after_first_none_zero; index <= last_none_zero_index; index += 4) {
-#ifdef DEBUG
-                size_t value = 0;
-                if(significand_bit_data[index]) value += 2 * 2 * 2;         // 2^(3)
-                if(index + 1 <= last_none_zero_index) {
-                    if(significand_bit_data[index + 1]) value += 2 * 2;     // 2^(2)
-                    if(index + 2 <= last_none_zero_index) {
-                        if(significand_bit_data[index + 2]) value += 2;     // 2^(1)
-                        if(index + 3 <= last_none_zero_index) {
-                            if(significand_bit_data[index + 3]) value += 1; // 2^(0)
-                        }
-                    }
-                }
-                DEBUG_ASSERT(value < ARRAY_SIZE(base16_character_lowercase));
-#endif
-                re_precision++;
-            }
-            interprate->precision = re_precision;
-        }
-#endif
         pure_width += interprate->precision; // 1.xxxxxxx [x num]
         pure_width += 2;                     // p(+/-)
         pure_width += exponent_digits;       // p+xxx [x num]
@@ -3897,11 +5591,11 @@ static bool printf_output_specifier_floating_point_specifier_aA(printf_core_ref
         printf_specifier_a_pure_data_t pure_data_store;
         printf_specifier_a_pure_data_ref pure_data = &pure_data_store;
         pure_data->pure_width = pure_width;
-        pure_data->significand_bit_data = significand_bit_data;
+        pure_data->fraction_high = fraction_high;
+        pure_data->fraction_low = fraction_low;
+        pure_data->leading = leading;
         pure_data->is_uppercase = is_uppercase;
         pure_data->has_decimal_point = has_decimal_point;
-        pure_data->index_after_first_none_zero = index_after_first_none_zero;
-        pure_data->last_none_zero_index = last_none_zero_index;
         pure_data->is_exponent_negative = is_exponent_negative;
         pure_data->exponent_abs = exponent_abs;
         pure_data->exponent_digits = exponent_digits;
@@ -3927,38 +5621,29 @@ static bool printf_specifier_a_pure_function(printf_core_ref _Nonnull core,
                                              size_t pure_width,
                                              void * _Nonnull input) {
     if(core != NULL && interprate != NULL && input != NULL) {
+        SCRATCH_ARENA_SCOPE;
         printf_specifier_a_pure_data_ref pure_data = (printf_specifier_a_pure_data_ref)input;
-        if(pure_data->significand_bit_data != NULL && pure_data->pure_width == pure_width) {
-            printf_core_output_character(core, CHARACTER_1);
+        if(pure_data->pure_width == pure_width) {
+            DEBUG_ASSERT(pure_data->leading <= 2);
+            printf_core_output_character(core, base16_character_lowercase[pure_data->leading]);
             if(pure_data->has_decimal_point) printf_core_output_character(core, CHARACTER_dot);
-            bool * _Nonnull significand_bit_data = pure_data->significand_bit_data;
+            uint64_t fraction_high = pure_data->fraction_high;
+            uint64_t fraction_low = pure_data->fraction_low;
             bool is_uppercase = pure_data->is_uppercase;
             bool is_exponent_negative = pure_data->is_exponent_negative;
             size_t exponent_abs = pure_data->exponent_abs;
             size_t precision = interprate->precision;
-            size_t index_after_first_none_zero = pure_data->index_after_first_none_zero;
-            size_t last_none_zero_index = pure_data->last_none_zero_index;
             size_t exponent_digits = pure_data->exponent_digits;
             DEBUG_ASSERT(exponent_digits >= 1);
             for(size_t index = 0; index < precision; index++) {
-                // index_after_first_none_zero + index * 4
-                // index_after_first_none_zero + index * 4 + 1
-                // index_after_first_none_zero + index * 4 + 2
-                // index_after_first_none_zero + index * 4 + 3
-                if(index_after_first_none_zero + index * 4 > last_none_zero_index)
-                    printf_core_output_character(core, CHARACTER_0);
+                if(fraction_high == 0 && fraction_low == 0) {
+                    printf_core_output_fill(core, CHARACTER_0, precision - index);
+                    break;
+                }
                 else {
-                    size_t value = 0;
-                    if(significand_bit_data[index_after_first_none_zero + index * 4]) value += 2 * 2 * 2;         // 2^(3)
-                    if(index_after_first_none_zero + index * 4 + 1 <= last_none_zero_index) {
-                        if(significand_bit_data[index_after_first_none_zero + index * 4 + 1]) value += 2 * 2;     // 2^(2)
-                        if(index_after_first_none_zero + index * 4 + 2 <= last_none_zero_index) {
-                            if(significand_bit_data[index_after_first_none_zero + index * 4 + 2]) value += 2;     // 2^(1)
-                            if(index_after_first_none_zero + index * 4 + 3 <= last_none_zero_index) {
-                                if(significand_bit_data[index_after_first_none_zero + index * 4 + 3]) value += 1; // 2^(0)
-                            }
-                        }
-                    }
+                    size_t value = fraction_high >> 60;
+                    fraction_high = (fraction_high << 4) | (fraction_low >> 60);
+                    fraction_low <<= 4;
                     DEBUG_ASSERT(value < ARRAY_SIZE(base16_character_lowercase));
                     printf_core_output_character(core,
                                                  is_uppercase ?
@@ -3975,7 +5660,8 @@ static bool printf_specifier_a_pure_function(printf_core_ref _Nonnull core,
                                          CHARACTER_minus:
                                          CHARACTER_plus);
             DEBUG_ASSERT(UCHAR_MAX >= 9);
-            unsigned char * exponent_store = printf_stack_alloc(sizeof(unsigned char) * exponent_digits);
+            unsigned char * exponent_store = printf_scratch_alloc(sizeof(unsigned char) * exponent_digits);
+            if(exponent_store == NULL) DEBUG_RETURN(false);
             size_t index = 0;
             do exponent_store[index++] = exponent_abs % 10; while((exponent_abs /= 10) > 0);
             DEBUG_ASSERT(index == exponent_digits);
@@ -3990,10 +5676,33 @@ static bool printf_specifier_a_pure_function(printf_core_ref _Nonnull core,
     return false;
 }
 
+/*!
+    @function printf_output_specifier_floating_point_fpbc_output
+    @abstract output [fFeEgG] specifier from a fpbc ready for query
+ */
+static bool printf_output_specifier_floating_point_fpbc_output(printf_core_ref _Nonnull core,
+                                                               printf_interprate_ref _Nonnull interprate,
+                                                               fp_info_ref _Nonnull info,
+                                                               fpbc_ref _Nonnull fpbc) {
+    switch (interprate->type) {
+        case printf_specifier_f:
+        case printf_specifier_F:
+            return printf_output_specifier_floating_point_specifier_fF(core, interprate, info, fpbc);
+        case printf_specifier_e:
+        case printf_specifier_E:
+            return printf_output_specifier_floating_point_specifier_eE(core, interprate, info, fpbc);
+        case printf_specifier_g:
+        case printf_specifier_G:
+            return printf_output_specifier_floating_point_specifier_gG(core, interprate, info, fpbc);
+        default: DEBUG_RETURN(false);
+    }
+}
+
 static bool printf_output_specifier_floating_point_classification_normal(printf_core_ref _Nonnull core,
                                                                          printf_interprate_ref _Nonnull interprate,
                                                                          fp_info_ref _Nonnull info) {
     if(core != NULL && interprate != NULL && info != NULL && printf_specifier_type_is_floating_point_inline(interprate->type)) {
+        SCRATCH_ARENA_SCOPE;
         
         if(interprate->type == printf_specifier_a || interprate->type == printf_specifier_A)
             return printf_output_specifier_floating_point_specifier_aA(core, interprate, info, true);
@@ -4003,39 +5712,38 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
             
             fpbc->sign = floating_point_info_query_sign_bit_inline(info);
             
-            unsigned int exponent = floating_point_info_query_raw_exponent_inline(info);
-            unsigned int exponent_base = floating_point_query_exponent_base(info);
+#ifdef PRINTF_FLOATING_POINT_FIXED_64
+            if(printf_output_specifier_floating_point_fpbc_prepare_fixed(interprate, info, fpbc))
+                return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
+#endif
             
-            size_t need_for_query_significand_bit =
-            floating_point_info_query_significand_bit(info, NULL, 0);
+#if defined PRINTF_FLOATING_POINT_SHORTEST_64 || defined PRINTF_FLOATING_POINT_SHORTEST_32
+            if(printf_output_specifier_floating_point_fpbc_prepare_shortest(interprate, info, fpbc))
+                return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
+#endif
             
-            // most impossible condition
-            if(need_for_query_significand_bit * sizeof(bool) > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
+            if(printf_output_specifier_floating_point_fpbc_prepare_exact(interprate, info, fpbc))
+                return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
             
-            bool *significand_bit_data = printf_stack_alloc(need_for_query_significand_bit * sizeof(bool));
-            floating_point_info_query_significand_bit(info, significand_bit_data, need_for_query_significand_bit);
+            unsigned int exponent = floating_point_info_query_raw_exponent_inline(info);
+            unsigned int exponent_base = floating_point_query_exponent_base(info);
             
-            bool nearby_down_decrease_exponent = true;
-            for(size_t index = 0; index < need_for_query_significand_bit; index++)
-                if(significand_bit_data[index]) {
-                    nearby_down_decrease_exponent = false;
-                    break;
-                }
+            size_t significand_bit_amount = floating_point_info_query_significand_bit_amount_inline(info);
+            bool nearby_down_decrease_exponent = floating_point_info_query_significand_inline(info) == 0 &&
+                                                 floating_point_info_query_significand_high_inline(info) == 0;
             
             // bit for significand (implicit + explicit) == significand_bit + 1
-            // e - p == exponent - exponent_base - need_for_query_significand_bit
+            // e - p == exponent - exponent_base - significand_bit_amount
             
             int e_minus_p;
             if(__builtin_sub_overflow(exponent, exponent_base, &e_minus_p)) DEBUG_RETURN(false);
-            if(__builtin_sub_overflow(e_minus_p, need_for_query_significand_bit, &e_minus_p)) DEBUG_RETURN(false);
+            if(__builtin_sub_overflow(e_minus_p, significand_bit_amount, &e_minus_p)) DEBUG_RETURN(false);
             
-            // [Document] GNU other builtins
-            // The lifetime of the allocated object ends just before the calling function returns to its caller.
-            // This is so even when __builtin_alloca is called within a nested block.
+            // numbers allocated in nested block live until SCRATCH_ARENA_SCOPE of this function ends
             if(e_minus_p >= 0) {
                 
                 // [1] could just store significand(with implicit one) offseted (e - p)
-                size_t bit_length = need_for_query_significand_bit + 1 + e_minus_p;
+                size_t bit_length = significand_bit_amount + 1 + e_minus_p;
                 
                 // [2] nearby_down_decrease_exponent
                 if(nearby_down_decrease_exponent) bit_length++;
@@ -4049,17 +5757,21 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
                 //      (3) scale is scaled by base to more than this need 4 more
                 bit_length += 4;
                 
-                // [5] calculation remain multi base [impossible for scale is scaled by B need 4 more]
+                // [5] calculation remain multi base [scale is scaled by B up to 10 x v, need 4 more]
+                bit_length += 4;
                 
                 size_t length = EXT_ARRAY_SIZE_FOR_BIT(bit_length);
-                fpbc->remain = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->scale = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_down = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_up = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->base = printf_stack_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->remain = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->scale = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_down = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_up = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->base = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                if(fpbc->remain == NULL || fpbc->scale == NULL || fpbc->nearby_down == NULL ||
+                   fpbc->nearby_up == NULL || fpbc->base == NULL) DEBUG_RETURN(false);
                 fpbc->base_value = UINT32_C(10);
                 fpbc->length = length;
                 fpbc->exponent = 0;         // not much useful as decided in simple fixup
+                fpbc->digits_amount = 0;
                 
                 extended_integer_initialize(fpbc->remain, length);
                 extended_integer_initialize(fpbc->scale, length);
@@ -4072,18 +5784,8 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
                 extended_integer_set_bit(fpbc->base, length, 1, true);
                 extended_integer_set_bit(fpbc->base, length, 3, true);
                 
-                // [remain]
-                for(size_t index = 0; index < need_for_query_significand_bit; index++) {
-                    // bit_index = e_minus_p + index
-                    // bit_value = significand_bit_data[need_for_query_significand_bit - index - 1]
-                    size_t bit_index = e_minus_p + index;
-                    DEBUG_ASSERT(!__builtin_add_overflow(e_minus_p, index, &bit_index));
-                    bool bit_value = significand_bit_data[need_for_query_significand_bit - index - 1];
-                    extended_integer_set_bit(fpbc->remain, length, bit_index, bit_value);
-                }
-                
                 // [remain] implicit to one
-                extended_integer_set_bit(fpbc->remain, length, e_minus_p + need_for_query_significand_bit, true);
+                floating_point_info_set_significand_inline(info, fpbc->remain, length, e_minus_p, true);
                 
                 // [scale] setted to one
                 extended_integer_set_bit(fpbc->scale, length, 0, true);
@@ -4101,13 +5803,13 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
                 bool is_remain_less_than_scale;
                 size_t bit_length;
                 
-                // [1] max[ (need_for_query_significand_bit + 1), p_minus_e + 1 ]
-                if(need_for_query_significand_bit + 1 > p_minus_e + 1)
+                // [1] max[ (significand_bit_amount + 1), p_minus_e + 1 ]
+                if(significand_bit_amount + 1 > p_minus_e + 1)
                      is_remain_less_than_scale = true;
                 else is_remain_less_than_scale = false;
                 
                 if(is_remain_less_than_scale)
-                     bit_length = need_for_query_significand_bit + 1;
+                     bit_length = significand_bit_amount + 1;
                 else bit_length = p_minus_e + 1;
                 
                 // [2] nearby_down_decrease_exponent
@@ -4127,14 +5829,17 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
                 bit_length += 4;
                 
                 size_t length = EXT_ARRAY_SIZE_FOR_BIT(bit_length);
-                fpbc->remain = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->scale = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_down = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_up = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->base = printf_stack_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->remain = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->scale = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_down = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_up = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->base = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                if(fpbc->remain == NULL || fpbc->scale == NULL || fpbc->nearby_down == NULL ||
+                   fpbc->nearby_up == NULL || fpbc->base == NULL) DEBUG_RETURN(false);
                 fpbc->base_value = UINT32_C(10);
                 fpbc->length = length;
                 fpbc->exponent = 0;         // not much useful as decided in simple fixup
+                fpbc->digits_amount = 0;
                 
                 extended_integer_initialize(fpbc->remain, length);
                 extended_integer_initialize(fpbc->scale, length);
@@ -4147,17 +5852,8 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
                 extended_integer_set_bit(fpbc->base, length, 1, true);
                 extended_integer_set_bit(fpbc->base, length, 3, true);
                 
-                // [remain]
-                for(size_t index = 0; index < need_for_query_significand_bit; index++) {
-                    // bit_index = index
-                    // bit_value = significand_bit_data[need_for_query_significand_bit - index - 1]
-                    size_t bit_index = index;
-                    bool bit_value = significand_bit_data[need_for_query_significand_bit - index - 1];
-                    extended_integer_set_bit(fpbc->remain, length, bit_index, bit_value);
-                }
-                
                 // [remain] implicit to one
-                extended_integer_set_bit(fpbc->remain, length, need_for_query_significand_bit, true);
+                floating_point_info_set_significand_inline(info, fpbc->remain, length, 0, true);
                 
                 // [scale] setted to one
                 extended_integer_set_bit(fpbc->scale, length, p_minus_e, true);
@@ -4173,19 +5869,10 @@ static bool printf_output_specifier_floating_point_classification_normal(printf_
             
             if(!printf_output_specifier_floating_point_fpbc_simple_fixup(info, fpbc, nearby_down_decrease_exponent))
                 DEBUG_RETURN(false);
+            if(!printf_output_specifier_floating_point_fpbc_prepare_exact_extended(interprate, fpbc))
+                DEBUG_RETURN(false);
             
-            switch (interprate->type) {
-                case printf_specifier_f:
-                case printf_specifier_F:
-                    return printf_output_specifier_floating_point_specifier_fF(core, interprate, info, fpbc);
-                case printf_specifier_e:
-                case printf_specifier_E:
-                    return printf_output_specifier_floating_point_specifier_eE(core, interprate, info, fpbc);
-                case printf_specifier_g:
-                case printf_specifier_G:
-                    return printf_output_specifier_floating_point_specifier_gG(core, interprate, info, fpbc);
-                default: DEBUG_RETURN(false);
-            }
+            return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
         }
     } DEBUG_ELSE
     return false;
@@ -4195,6 +5882,7 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
                                                                             printf_interprate_ref _Nonnull interprate,
                                                                             fp_info_ref _Nonnull info) {
     if(core != NULL && interprate != NULL && info != NULL && printf_specifier_type_is_floating_point_inline(interprate->type)) {
+        SCRATCH_ARENA_SCOPE;
         
         if(interprate->type == printf_specifier_a || interprate->type == printf_specifier_A)
             return printf_output_specifier_floating_point_specifier_aA(core, interprate, info, false);
@@ -4204,43 +5892,38 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
             
             fpbc->sign = floating_point_info_query_sign_bit_inline(info);
             
-            unsigned int exponent = floating_point_info_query_raw_exponent_inline(info);
-            unsigned int exponent_base = floating_point_query_exponent_base(info);
+#ifdef PRINTF_FLOATING_POINT_FIXED_64
+            if(printf_output_specifier_floating_point_fpbc_prepare_fixed(interprate, info, fpbc))
+                return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
+#endif
             
-            size_t need_for_query_significand_bit =
-            floating_point_info_query_significand_bit(info, NULL, 0);
+            if(printf_output_specifier_floating_point_fpbc_prepare_exact(interprate, info, fpbc))
+                return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
             
-            // most impossible condition
-            if(need_for_query_significand_bit * sizeof(bool) > PRINTF_STACK_ALLOCATION_LIMIT) DEBUG_RETURN(false);
+            // raw exponent zero stands for the least normal exponent
+            unsigned int exponent = floating_point_info_query_raw_exponent_inline(info) + 1;
+            unsigned int exponent_base = floating_point_query_exponent_base(info);
             
-            bool *significand_bit_data = printf_stack_alloc(need_for_query_significand_bit * sizeof(bool));
-            floating_point_info_query_significand_bit(info, significand_bit_data, need_for_query_significand_bit);
+            size_t significand_bit_amount = floating_point_info_query_significand_bit_amount_inline(info);
             
             // bit for significand (implicit + explicit) == significand_bit + 1
-            // e - p == exponent - exponent_base - need_for_query_significand_bit
+            // e - p == exponent - exponent_base - significand_bit_amount
             
-            bool all_zero_significand_bit = true;
-            for(size_t index = 0; index < need_for_query_significand_bit; index++)
-                if(significand_bit_data[index]) {
-                    all_zero_significand_bit = false;
-                    break;
-                }
-            if(all_zero_significand_bit) DEBUG_RETURN(false);
+            if(floating_point_info_query_significand_inline(info) == 0 &&
+               floating_point_info_query_significand_high_inline(info) == 0) DEBUG_RETURN(false);
             
             int e_minus_p;
             if(__builtin_sub_overflow(exponent, exponent_base, &e_minus_p)) DEBUG_RETURN(false);
-            if(__builtin_sub_overflow(e_minus_p, need_for_query_significand_bit, &e_minus_p)) DEBUG_RETURN(false);
+            if(__builtin_sub_overflow(e_minus_p, significand_bit_amount, &e_minus_p)) DEBUG_RETURN(false);
             
             DEBUG_ASSERT(e_minus_p < 0); // once not possible ??? [with IEE 754 implementation]
             
-            // [Document] GNU other builtins
-            // The lifetime of the allocated object ends just before the calling function returns to its caller.
-            // This is so even when __builtin_alloca is called within a nested block.
+            // numbers allocated in nested block live until SCRATCH_ARENA_SCOPE of this function ends
             if(e_minus_p >= 0) {
                 // unreachable code [currently]
                 
                 // [1] could just store significand(without implicit one) offseted (e - p)
-                size_t bit_length = need_for_query_significand_bit + e_minus_p;
+                size_t bit_length = significand_bit_amount + e_minus_p;
                 
                 // [2] nearby_down_decrease_exponent [never possible]
                 
@@ -4257,14 +5940,17 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
                 bit_length += 4;
                 
                 size_t length = EXT_ARRAY_SIZE_FOR_BIT(bit_length);
-                fpbc->remain = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->scale = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_down = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_up = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->base = printf_stack_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->remain = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->scale = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_down = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_up = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->base = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                if(fpbc->remain == NULL || fpbc->scale == NULL || fpbc->nearby_down == NULL ||
+                   fpbc->nearby_up == NULL || fpbc->base == NULL) DEBUG_RETURN(false);
                 fpbc->base_value = UINT32_C(10);
                 fpbc->length = length;
                 fpbc->exponent = 0;         // not much useful as decided in simple fixup
+                fpbc->digits_amount = 0;
                 
                 extended_integer_initialize(fpbc->remain, length);
                 extended_integer_initialize(fpbc->scale, length);
@@ -4280,14 +5966,7 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
 // [NOTE] [optimization] subnormal floating point without implicit one may need less space
                 
                 // [remain]
-                for(size_t index = 0; index < need_for_query_significand_bit; index++) {
-                    // bit_index = e_minus_p + index
-                    // bit_value = significand_bit_data[need_for_query_significand_bit - index - 1]
-                    size_t bit_index = e_minus_p + index;
-                    DEBUG_ASSERT(!__builtin_add_overflow(e_minus_p, index, &bit_index));
-                    bool bit_value = significand_bit_data[need_for_query_significand_bit - index - 1];
-                    extended_integer_set_bit(fpbc->remain, length, bit_index, bit_value);
-                }
+                floating_point_info_set_significand_inline(info, fpbc->remain, length, e_minus_p, false);
                 
                 // [scale] setted to one
                 extended_integer_set_bit(fpbc->scale, length, 0, true);
@@ -4305,13 +5984,13 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
                 bool is_remain_less_than_scale;
                 size_t bit_length;
 
-                // [1] max[ (need_for_query_significand_bit), p_minus_e + 1 ]
-                if(need_for_query_significand_bit > p_minus_e + 1)
+                // [1] max[ (significand_bit_amount), p_minus_e + 1 ]
+                if(significand_bit_amount > p_minus_e + 1)
                      is_remain_less_than_scale = true;
                 else is_remain_less_than_scale = false;
 
                 if(is_remain_less_than_scale)
-                     bit_length = need_for_query_significand_bit;
+                     bit_length = significand_bit_amount;
                 else bit_length = p_minus_e + 1;
                 
                 // [2] nearby_down_decrease_exponent [impossible]
@@ -4329,17 +6008,20 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
                 // [5] calculation remain multi base [impossible for scale is scaled by B need 4 more]
                 bit_length += 4;
                 
-// [NOTE] [optimization] need_for_query_significand_bit first non-zero position need less space
+// [NOTE] [optimization] significand_bit_amount first non-zero position need less space
                 
                 size_t length = EXT_ARRAY_SIZE_FOR_BIT(bit_length);
-                fpbc->remain = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->scale = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_down = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->nearby_up = printf_stack_alloc(sizeof(EXT_TYPE) * length);
-                fpbc->base = printf_stack_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->remain = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->scale = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_down = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->nearby_up = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                fpbc->base = printf_scratch_alloc(sizeof(EXT_TYPE) * length);
+                if(fpbc->remain == NULL || fpbc->scale == NULL || fpbc->nearby_down == NULL ||
+                   fpbc->nearby_up == NULL || fpbc->base == NULL) DEBUG_RETURN(false);
                 fpbc->base_value = UINT32_C(10);
                 fpbc->length = length;
                 fpbc->exponent = 0;         // not much useful as decided in simple fixup
+                fpbc->digits_amount = 0;
                 
                 extended_integer_initialize(fpbc->remain, length);
                 extended_integer_initialize(fpbc->scale, length);
@@ -4353,13 +6035,7 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
                 extended_integer_set_bit(fpbc->base, length, 3, true);
                 
                 // [remain]
-                for(size_t index = 0; index < need_for_query_significand_bit; index++) {
-                    // bit_index = index
-                    // bit_value = significand_bit_data[need_for_query_significand_bit - index - 1]
-                    size_t bit_index = index;
-                    bool bit_value = significand_bit_data[need_for_query_significand_bit - index - 1];
-                    extended_integer_set_bit(fpbc->remain, length, bit_index, bit_value);
-                }
+                floating_point_info_set_significand_inline(info, fpbc->remain, length, 0, false);
                 
                 // [scale] setted to one
                 extended_integer_set_bit(fpbc->scale, length, p_minus_e, true);
@@ -4375,19 +6051,10 @@ static bool printf_output_specifier_floating_point_classification_subnormal(prin
             
             if(!printf_output_specifier_floating_point_fpbc_simple_fixup(info, fpbc, false))
                 DEBUG_RETURN(false);
+            if(!printf_output_specifier_floating_point_fpbc_prepare_exact_extended(interprate, fpbc))
+                DEBUG_RETURN(false);
             
-            switch (interprate->type) {
-                case printf_specifier_f:
-                case printf_specifier_F:
-                    return printf_output_specifier_floating_point_specifier_fF(core, interprate, info, fpbc);
-                case printf_specifier_e:
-                case printf_specifier_E:
-                    return printf_output_specifier_floating_point_specifier_eE(core, interprate, info, fpbc);
-                case printf_specifier_g:
-                case printf_specifier_G:
-                    return printf_output_specifier_floating_point_specifier_gG(core, interprate, info, fpbc);
-                default: DEBUG_RETURN(false);
-            }
+            return printf_output_specifier_floating_point_fpbc_output(core, interprate, info, fpbc);
         }
     } DEBUG_ELSE
     return false;
@@ -4417,10 +6084,25 @@ static bool printf_output_specifier_floating_point(printf_core_ref _Nonnull core
                 fp64_t value = va_arg(core->args, double);
                 if(!floating_point_intialize_64bit_inline(info, value)) DEBUG_RETURN(false);
             }   break;
-            case printf_interprate_length_L: {
+            case printf_interprate_length_L: {      // long double  (80 or 64)
+#ifdef PRINTF_FLOATING_POINT_80
+                fp80_t value = va_arg(core->args, long double);
+                if(!floating_point_intialize_80bit_inline(info, value)) DEBUG_RETURN(false);
+#else
                 fp64_t value = va_arg(core->args, long double);
                 if(!floating_point_intialize_64bit_inline(info, value)) DEBUG_RETURN(false);
+#endif
+            }   break;
+            case printf_interprate_length_h: {      // float        (32) passed as double
+                fp32_t value = (fp32_t)va_arg(core->args, double);
+                if(!floating_point_intialize_32bit_inline(info, value)) DEBUG_RETURN(false);
             }   break;
+#ifdef PRINTF_FLOATING_POINT_128
+            case printf_interprate_length_Q: {      // __float128   (128)
+                fp128_t value = va_arg(core->args, __float128);
+                if(!floating_point_intialize_128bit_inline(info, value)) DEBUG_RETURN(false);
+            }   break;
+#endif
             default: DEBUG_RETURN(false);
         }
         
@@ -4836,10 +6518,10 @@ static bool printf_output_specifier_pointer(printf_core_ref _Nonnull core, print
         // output as format x
         interprate->type = printf_specifier_x;
         
-        // force to mark complex flag
+        // force to mark complex flag, 0x is kept for null too
         interprate->flag |= printf_interprate_flag_complex;
         
-        return printf_output_specifier_integer_iduoxX(core, interprate);
+        return printf_output_specifier_integer_iduoxX(core, interprate, true);
     } DEBUG_ELSE
     return false;
 }
@@ -4967,112 +6649,440 @@ static bool printf_specifier_percentage_pure_function(printf_core_ref _Nonnull c
 
 #pragma mark - printf_internal
 
+/*!
+    @function printf_core_output_interprate
+    @abstract dispatch a parsed interprate to its specifier output
+    @param validate_check set to false if interprate is not a valid specifier
+    @return false if output should stop at this point
+*/
+static bool printf_core_output_interprate(printf_core_ref _Nonnull core,
+                                          printf_interprate_ref _Nonnull interprate,
+                                          bool * _Nonnull validate_check) {
+    if(core != NULL && interprate != NULL && validate_check != NULL) {
+        switch (interprate->type) {
+            case printf_specifier_d_or_i:
+            case printf_specifier_u:
+            case printf_specifier_o:
+            case printf_specifier_x:
+            case printf_specifier_X:
+                return printf_output_specifier_integer_iduoxX(core, interprate, false);
+                
+            case printf_specifier_f:
+            case printf_specifier_F:
+            case printf_specifier_e:
+            case printf_specifier_E:
+            case printf_specifier_g:
+            case printf_specifier_G:
+            case printf_specifier_a:
+            case printf_specifier_A:
+                return printf_output_specifier_floating_point(core, interprate);
+            
+            case printf_specifier_c:
+                return printf_output_specifier_character(core, interprate);
+            
+            case printf_specifier_s:
+                return printf_output_specifier_string(core, interprate);
+            
+            case printf_specifier_p:
+                return printf_output_specifier_pointer(core, interprate);
+            
+            case printf_specifier_n:
+                return printf_output_specifier_count(core, interprate);
+            
+            case printf_specifier_percentage:
+                return printf_output_specifier_percentage(core, interprate);
+            
+            /* case error handle */
+            case printf_specifier_invalid: default:
+                DEBUG_POINT
+                validate_check[0] = false;
+                return false;
+        }
+    } DEBUG_ELSE
+    if(validate_check != NULL) validate_check[0] = false;
+    return false;
+}
+
+/*!
+    @function printf_internal_complete
+    @abstract finalize output and make the return value for printf_internal
+*/
+static int printf_internal_complete(printf_core_ref _Nonnull core, bool validate_check) {
+    if(!printf_core_format_validation_resolve(core))
+        validate_check = false;
+    
+    printf_core_output_finalize_inline(core);
+    
+    if(validate_check)
+        switch (core->type) {
+            case printf_type_string:
+                return (int)core->actual_need;
+            case printf_type_FILE:
+                return 0;
+            default: DEBUG_RETURN(PRINTF_ERROR_RETURN);
+        }
+    
+    printf_core_error_handle(core);     // last error handling
+    
+    DEBUG_RETURN(PRINTF_ERROR_RETURN);
+}
+
 int printf_internal(printf_core_ref _Nonnull core) {
     if(!printf_core_validate(core))
         return PRINTF_ERROR_RETURN;
-    if(core->format == NULL || !printf_UTF8Str_validate(core->format, NULL))
+    if(core->format == NULL)
         return PRINTF_ERROR_RETURN;
     
     printf_core_output_initialize_inline(core);
     
+    SCRATCH_ARENA_SCOPE;    // everything temporary is released when the call finishes
+    
     bool validate_check = true;
     
     while(core->format[0] != CHARACTER_null) {      // output loop
-        const UTF8Char *next_escape = printf_strchr_inline(core->format, CHARACTER_percentage);
-        if(next_escape == NULL) {
-            size_t format_length = printf_strlen_inline(core->format);
-            printf_core_output_raw_string(core, core->format, format_length);
-            // core->format += format_length;
-            // DEBUG_ASSERT(core->format[0] == CHARACTER_null);
-            goto LABEL_validate_failed_exit_point;
-        }
-        else {
-            DEBUG_ASSERT(next_escape >= core->format);
-            if(next_escape > core->format) {
-                size_t before_escape = next_escape - core->format;
-                printf_core_output_raw_string(core, core->format, before_escape);
-                core->format += before_escape;
-                DEBUG_ASSERT(core->format[0] == CHARACTER_percentage);
-            }
-            DEBUG_ASSERT(core->format == next_escape);
-            // currently core->format point to the escape character
-            printf_interprate_t interprate;
-            if(printf_interprate_parser(core, &interprate)) {
-                switch (interprate.type) {
-                    case printf_specifier_d_or_i:
-                    case printf_specifier_u:
-                    case printf_specifier_o:
-                    case printf_specifier_x:
-                    case printf_specifier_X:
-                        if(!printf_output_specifier_integer_iduoxX(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                        
-                    case printf_specifier_f:
-                    case printf_specifier_F:
-                    case printf_specifier_e:
-                    case printf_specifier_E:
-                    case printf_specifier_g:
-                    case printf_specifier_G:
-                    case printf_specifier_a:
-                    case printf_specifier_A:
-                        if(!printf_output_specifier_floating_point(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                    
-                    case printf_specifier_c:
-                        if(!printf_output_specifier_character(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                    
-                    case printf_specifier_s:
-                        if(!printf_output_specifier_string(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                    
-                    case printf_specifier_p:
-                        if(!printf_output_specifier_pointer(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                    
-                    case printf_specifier_n:
-                        if(!printf_output_specifier_count(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                    
-                    case printf_specifier_percentage:
-                        if(!printf_output_specifier_percentage(core, &interprate))
-                            goto LABEL_validate_failed_exit_point;
-                        break;
-                    
-                    /* case error handle */
-                    case printf_specifier_invalid: default:
-                        DEBUG_POINT
-                        validate_check = false;
-                        goto LABEL_validate_failed_exit_point;
-                }
-            } else {
+        bool non_ascii;
+        size_t literal_length = printf_literal_span_length_inline(core->format, &non_ascii);
+        if(literal_length > 0) {
+            const UTF8Char *literal = core->format;
+            if(non_ascii && !printf_UTF8Span_validate(literal, literal_length)) {
                 DEVELOP_BREAKPOINT
-                validate_check = false;
+                core->validation = printf_format_validation_malformed;
                 goto LABEL_validate_failed_exit_point;
             }
+            core->format += literal_length;
+            printf_core_output_raw_bytes(core, literal, literal_length);
+            if(core->format[0] == CHARACTER_null) break;
+        }
+        DEBUG_ASSERT(core->format[0] == CHARACTER_percentage);
+        // currently core->format point to the escape character
+        printf_interprate_t interprate;
+        if(printf_interprate_parser(core, &interprate)) {
+            if(!printf_core_output_interprate(core, &interprate, &validate_check))
+                goto LABEL_validate_failed_exit_point;
+        } else {
+            DEVELOP_BREAKPOINT
+            core->validation = printf_format_validation_malformed;
+            validate_check = false;
+            goto LABEL_validate_failed_exit_point;
         }
     }
     
     LABEL_validate_failed_exit_point:;
     
-    if(validate_check)
-        switch (core->type) {
-            case printf_type_string:
-                return (int)core->actual_need;
-            case printf_type_FILE:
-                return 0;
-            default: DEBUG_RETURN(PRINTF_ERROR_RETURN);
+    return printf_internal_complete(core, validate_check);
+}
+
+#pragma mark - printf_program
+
+/*
+ 
+ [ compiled format ]
+ 
+ a format is validated and parsed once by CA_format_compile into a list of steps,
+ each step is either a literal span or a pre-filled interprate, running it only
+ does the va_list fetching and output
+ 
+*/
+
+typedef enum printf_program_step_type {
+    printf_program_step_literal,
+    printf_program_step_interprate
+} printf_program_step_type;
+
+typedef struct printf_program_step {
+    printf_program_step_type type;
+    const UTF8Char * _Nullable literal;     // only for printf_program_step_literal
+    size_t literal_length;                  // only for printf_program_step_literal
+    printf_interprate_t interprate;         // only for printf_program_step_interprate
+} printf_program_step_t;
+
+/*!
+    @struct CA_format
+    @abstract immutable once compiled, interprate is copied before every use
+    @arg format private copy of the compiled format, steps point into it
+*/
+struct CA_format {
+    const UTF8Char * _Nonnull format;
+    size_t step_count;
+    printf_program_step_t steps[];
+};
+
+/*!
+    @function printf_program_build
+    @abstract parse format into steps, format is UTF8 validated at the same time
+    @param steps if NULL, only step_count is counted
+    @return true if format is valid
+*/
+static bool printf_program_build(const UTF8Char * _Nonnull format,
+                                 printf_program_step_t * _Nullable steps,
+                                 size_t * _Nonnull step_count) {
+    if(format != NULL && step_count != NULL) {
+        size_t count = 0;
+        while(format[0] != CHARACTER_null) {
+            bool non_ascii;
+            size_t literal_length = printf_literal_span_length_inline(format, &non_ascii);
+            if(literal_length > 0) {
+                if(non_ascii && !printf_UTF8Span_validate(format, literal_length)) return false;
+                if(steps != NULL) {
+                    steps[count].type = printf_program_step_literal;
+                    steps[count].literal = format;
+                    steps[count].literal_length = literal_length;
+                }
+                count++;
+                format += literal_length;
+            }
+            if(format[0] == CHARACTER_percentage) {
+                printf_interprate_t interprate;
+                if(!printf_interprate_parse_format(&format, &interprate)) return false;
+                if(steps != NULL) {
+                    steps[count].type = printf_program_step_interprate;
+                    steps[count].literal = NULL;
+                    steps[count].literal_length = 0;
+                    steps[count].interprate = interprate;
+                }
+                count++;
+            }
         }
+        step_count[0] = count;
+        return true;
+    } DEBUG_ELSE
+    return false;
+}
+
+/*!
+    @function printf_format_validate
+    @abstract UTF8 and every specifier of format are checked without output
+*/
+static bool printf_format_validate(const UTF8Char * _Nonnull format) {
+    size_t step_count;
+    return printf_program_build(format, NULL, &step_count);
+}
+
+/*!
+    @function printf_internal_program
+    @abstract same as printf_internal but running a compiled format
+*/
+static int printf_internal_program(printf_core_ref _Nonnull core, CA_format_ref _Nonnull program) {
+    if(program == NULL || !printf_core_validate(core))
+        return PRINTF_ERROR_RETURN;
     
-    printf_core_error_handle(core);     // last error handling
+    printf_core_output_initialize_inline(core);
+    core->validation = printf_format_validation_valid;     // validated by CA_format_compile
     
-    DEBUG_RETURN(PRINTF_ERROR_RETURN);
+    SCRATCH_ARENA_SCOPE;    // everything temporary is released when the call finishes
+    
+    bool validate_check = true;
+    
+    for(size_t index = 0; index < program->step_count; index++) {
+        const printf_program_step_t *step = &program->steps[index];
+        if(step->type == printf_program_step_literal) {
+            printf_core_output_raw_bytes(core, step->literal, step->literal_length);
+        }
+        else if(step->type == printf_program_step_interprate) {
+            printf_interprate_t interprate = step->interprate;
+            if(!printf_core_output_interprate(core, &interprate, &validate_check))
+                break;
+        }
+        else {
+            DEBUG_POINT
+            validate_check = false;
+            break;
+        }
+    }
+    
+    return printf_internal_complete(core, validate_check);
+}
+
+/*!
+    @function printf_program_size_inline
+    @abstract bytes of the program with step_count steps and its format copy
+*/
+static inline size_t printf_program_size_inline(size_t step_count, size_t length) {
+    return sizeof(CA_format_t) + step_count * sizeof(printf_program_step_t) + (length + 1) * sizeof(UTF8Char);
+}
+
+/*!
+    @function printf_program_compile
+    @abstract copy format into program and build its steps
+    @param program storage of printf_program_size_inline bytes at least
+    @param step_count counted by printf_program_build before
+*/
+static bool printf_program_compile(const UTF8Char * _Nonnull format,
+                                   size_t length,
+                                   size_t step_count,
+                                   CA_format_t * _Nonnull program) {
+    UTF8Char *format_copy = (UTF8Char *)((char *)program + sizeof(CA_format_t) + step_count * sizeof(printf_program_step_t));
+    __builtin_memcpy(format_copy, format, (length + 1) * sizeof(UTF8Char));
+    program->format = format_copy;
+    if(!printf_program_build(format_copy, program->steps, &program->step_count) ||
+       program->step_count != step_count)
+        DEBUG_RETURN(false);
+    return true;
+}
+
+CA_format_ref _Nullable CA_format_compile(const char * _Nonnull format) {
+    if(format != NULL) {
+        const UTF8Char *str = (const UTF8Char *)format;
+        size_t step_count;
+        if(!printf_program_build(str, NULL, &step_count))
+            DEVELOP_BREAKPOINT_RETURN(NULL);
+        
+        size_t length = printf_strlen_inline(str);
+        CA_format_t *program = malloc(printf_program_size_inline(step_count, length));
+        if(program == NULL) return NULL;
+        
+        if(!printf_program_compile(str, length, step_count, program)) {
+            free(program);
+            return NULL;
+        }
+        return program;
+    }
+    DEVELOP_BREAKPOINT_RETURN(NULL);
+}
+
+void CA_format_release(CA_format_ref _Nullable program) {
+    free((void *)program);
+}
+
+#pragma mark - format cache
+
+#ifdef PRINTF_FORMAT_CACHE_ENABLE
+
+COMILE_ASSERT((PRINTF_FORMAT_CACHE_SIZE & (PRINTF_FORMAT_CACHE_SIZE - 1)) == 0);
+
+// set while the slot is written, the bits below count calls reading the slot
+#define PRINTF_FORMAT_CACHE_WRITER      UINT32_C(0x80000000)
+
+/*!
+    @struct printf_format_cache_entry
+    @abstract one slot of the format cache, program lives in storage
+    @arg state PRINTF_FORMAT_CACHE_WRITER and the reader count
+    @arg key format address of the program, NULL if empty, only touched with state held
+    @arg candidate address that missed last, replaces key on its next miss
+*/
+typedef struct printf_format_cache_entry {
+    uint32_t state;
+    const char * _Nullable key;
+    const char * _Nullable candidate;
+    size_t hit_count;
+    size_t miss_count;
+    _Alignas(CA_format_t) unsigned char storage[PRINTF_FORMAT_CACHE_ENTRY_SIZE];
+} printf_format_cache_entry_t;
+
+static printf_format_cache_entry_t printf_format_cache[PRINTF_FORMAT_CACHE_SIZE];
+
+/*!
+    @function printf_format_cache_slot_inline
+    @abstract hash format address to a cache slot
+*/
+static inline size_t printf_format_cache_slot_inline(const char * _Nonnull format) {
+    uint64_t key = (uintptr_t)format;
+    key *= UINT64_C(0x9E3779B97F4A7C15);
+    return (size_t)(key >> 32) & (PRINTF_FORMAT_CACHE_SIZE - 1);
+}
+
+/*!
+    @function printf_format_cache_fill
+    @abstract compile format into the slot storage, state is held as writer
+    @return false if format is not valid or too large for the storage
+*/
+static bool printf_format_cache_fill(printf_format_cache_entry_t * _Nonnull entry, const char * _Nonnull format) {
+    const UTF8Char *str = (const UTF8Char *)format;
+    size_t step_count;
+    if(!printf_program_build(str, NULL, &step_count)) return false;
+    size_t length = printf_strlen_inline(str);
+    if(printf_program_size_inline(step_count, length) > sizeof(entry->storage)) return false;
+    return printf_program_compile(str, length, step_count, (CA_format_t *)entry->storage);
+}
+
+/*!
+    @function printf_format_cache_acquire
+    @abstract find the program for format and hold the slot as a reader
+    @discussion address is the key, content is compared in case of a reused buffer,
+                a miss never waits, the slot is written only when no call is reading it
+    @return NULL if format should be handled by printf_internal directly, the slot is not held then
+*/
+static CA_format_ref _Nullable printf_format_cache_acquire(printf_format_cache_entry_t * _Nonnull entry, const char * _Nonnull format) {
+    if(entry != NULL && format != NULL) {
+        const CA_format_t *program = (const CA_format_t *)entry->storage;
+        uint32_t state = __atomic_fetch_add(&entry->state, 1, __ATOMIC_ACQUIRE);
+        if(!(state & PRINTF_FORMAT_CACHE_WRITER) && entry->key == format &&
+           __builtin_strcmp((const char *)program->format, format) == 0) {
+            __atomic_fetch_add(&entry->hit_count, 1, __ATOMIC_RELAXED);
+            if(__atomic_load_n(&entry->candidate, __ATOMIC_RELAXED) != NULL)
+                __atomic_store_n(&entry->candidate, NULL, __ATOMIC_RELAXED);
+            return program;
+        }
+        __atomic_fetch_sub(&entry->state, 1, __ATOMIC_RELEASE);
+        __atomic_fetch_add(&entry->miss_count, 1, __ATOMIC_RELAXED);
+        
+        // admission, the first miss only marks the address
+        if(__atomic_load_n(&entry->candidate, __ATOMIC_RELAXED) != format) {
+            __atomic_store_n(&entry->candidate, format, __ATOMIC_RELAXED);
+            return NULL;
+        }
+        state = 0;
+        if(!__atomic_compare_exchange_n(&entry->state, &state, PRINTF_FORMAT_CACHE_WRITER, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            return NULL;    // busy, not worth waiting
+        
+        __atomic_store_n(&entry->candidate, NULL, __ATOMIC_RELAXED);
+        entry->key = printf_format_cache_fill(entry, format) ? format : NULL;
+        if(entry->key == NULL) {
+            __atomic_fetch_sub(&entry->state, PRINTF_FORMAT_CACHE_WRITER, __ATOMIC_RELEASE);
+            return NULL;
+        }
+        // writer turns into a reader, readers bounced meanwhile are still counted
+        __atomic_fetch_sub(&entry->state, PRINTF_FORMAT_CACHE_WRITER - 1, __ATOMIC_RELEASE);
+        return program;
+    } DEBUG_ELSE
+    return NULL;
+}
+
+/*!
+    @function printf_format_cache_release_inline
+    @abstract leave the slot held by printf_format_cache_acquire
+*/
+static inline void printf_format_cache_release_inline(printf_format_cache_entry_t * _Nonnull entry) {
+    __atomic_fetch_sub(&entry->state, 1, __ATOMIC_RELEASE);
+}
+
+#endif
+
+/*!
+    @function printf_internal_cached
+    @abstract printf_internal entry consulting the format cache if enabled
+*/
+static int printf_internal_cached(printf_core_ref _Nonnull core) {
+#ifdef PRINTF_FORMAT_CACHE_ENABLE
+    if(core != NULL && core->format != NULL) {
+        const char *format = (const char *)core->format;
+        printf_format_cache_entry_t *entry = &printf_format_cache[printf_format_cache_slot_inline(format)];
+        CA_format_ref program = printf_format_cache_acquire(entry, format);
+        if(program != NULL) {
+            int rt = printf_internal_program(core, program);
+            printf_format_cache_release_inline(entry);
+            return rt;
+        }
+    }
+#endif
+    return printf_internal(core);
+}
+
+void CA_format_cache_statistics(size_t * _Nullable hit, size_t * _Nullable miss) {
+#ifdef PRINTF_FORMAT_CACHE_ENABLE
+    // counted in each slot so hits of different formats do not contend
+    size_t hit_sum = 0, miss_sum = 0;
+    for(size_t index = 0; index < PRINTF_FORMAT_CACHE_SIZE; index++) {
+        hit_sum += __atomic_load_n(&printf_format_cache[index].hit_count, __ATOMIC_RELAXED);
+        miss_sum += __atomic_load_n(&printf_format_cache[index].miss_count, __ATOMIC_RELAXED);
+    }
+    if(hit != NULL) hit[0] = hit_sum;
+    if(miss != NULL) miss[0] = miss_sum;
+#else
+    if(hit != NULL) hit[0] = 0;
+    if(miss != NULL) miss[0] = 0;
+#endif
 }
 
 #pragma mark - stack_snprintf
@@ -5093,7 +7103,7 @@ int CA_snprintf(char * _Nullable store, size_t n, const char * _Nonnull format,
         core->output.string.index = 0;
         core->actual_need = 0;
         core->output.string.store = (UTF8Char *)store;
-        int rt = printf_internal(core);
+        int rt = printf_internal_cached(core);
         va_end(ap);
         va_end(core->args);
 #ifdef DEBUG
@@ -5116,8 +7126,12 @@ int CA_fprintf(FILE * _Nonnull fp, const char * _Nonnull format, ...) {
         va_copy(core->original_args, ap);
         core->original_format = (const UTF8Char *)format;
 #endif
-        core->output.file = fp;
-        int rt = printf_internal(core);
+        UTF8Char staging[PRINTF_FILE_STAGING_BUFFER_SIZE];
+        core->output.file.stream = fp;
+        core->output.file.buffer = staging;
+        core->output.file.count = PRINTF_FILE_STAGING_BUFFER_SIZE;
+        core->output.file.index = 0;
+        int rt = printf_internal_cached(core);
         va_end(ap);
         va_end(core->args);
 #ifdef DEBUG
@@ -5140,8 +7154,12 @@ int CA_printf(const char * _Nonnull format, ...) {
         va_copy(core->original_args, ap);
         core->original_format = (const UTF8Char *)format;
 #endif
-        core->output.file = stdout;
-        int rt = printf_internal(core);
+        UTF8Char staging[PRINTF_FILE_STAGING_BUFFER_SIZE];
+        core->output.file.stream = stdout;
+        core->output.file.buffer = staging;
+        core->output.file.count = PRINTF_FILE_STAGING_BUFFER_SIZE;
+        core->output.file.index = 0;
+        int rt = printf_internal_cached(core);
         va_end(ap);
         va_end(core->args);
 #ifdef DEBUG
@@ -5153,3 +7171,149 @@ int CA_printf(const char * _Nonnull format, ...) {
     // [BREAKPOINT] something is wrong but may not
     // be software problem please check the format input
 }
+
+int CA_snprintf_compiled(char * _Nullable store, size_t n, CA_format_ref _Nonnull program, ...) {
+    if(program != NULL) {
+        printf_core_t data; printf_core_ref core = &data;
+        core->type = printf_type_string;
+        core->format = program->format;
+        va_list ap;
+        va_start(ap, program);
+        va_copy(core->args, ap);
+#ifdef DEBUG
+        va_copy(core->original_args, ap);
+        core->original_format = program->format;
+#endif
+        core->output.string.count = n;
+        core->output.string.index = 0;
+        core->actual_need = 0;
+        core->output.string.store = (UTF8Char *)store;
+        int rt = printf_internal_program(core, program);
+        va_end(ap);
+        va_end(core->args);
+#ifdef DEBUG
+        va_end(core->original_args);
+#endif
+        return rt;
+    }
+    DEVELOP_BREAKPOINT_RETURN(PRINTF_ERROR_RETURN);
+}
+
+int CA_fprintf_compiled(FILE * _Nonnull fp, CA_format_ref _Nonnull program, ...) {
+    if(fp != NULL && program != NULL) {
+        printf_core_t data; printf_core_ref core = &data;
+        core->type = printf_type_FILE;
+        core->format = program->format;
+        va_list ap;
+        va_start(ap, program);
+        va_copy(core->args, ap);
+#ifdef DEBUG
+        va_copy(core->original_args, ap);
+        core->original_format = program->format;
+#endif
+        UTF8Char staging[PRINTF_FILE_STAGING_BUFFER_SIZE];
+        core->output.file.stream = fp;
+        core->output.file.buffer = staging;
+        core->output.file.count = PRINTF_FILE_STAGING_BUFFER_SIZE;
+        core->output.file.index = 0;
+        int rt = printf_internal_program(core, program);
+        va_end(ap);
+        va_end(core->args);
+#ifdef DEBUG
+        va_end(core->original_args);
+#endif
+        return rt;
+    }
+    DEVELOP_BREAKPOINT_RETURN(PRINTF_ERROR_RETURN);
+}
+
+#pragma mark - floating point value
+
+/*!
+    @function printf_floating_point_value_format
+    @abstract copy format of one [fFeEgGaA] conversion with length byte inserted before the specifier
+    @return false if format is not one such conversion [ length and asterisk not accepted ] or store is too small
+ */
+static bool printf_floating_point_value_format(const char * _Nonnull format,
+                                               UTF8Char length,
+                                               UTF8Char * _Nonnull store,
+                                               size_t count) {
+    if(format != NULL && store != NULL) {
+        const UTF8Char *current = (const UTF8Char *)format;
+        if(current[0] != CHARACTER_percentage) DEVELOP_BREAKPOINT_RETURN(false);
+        for(size_t index = 1; index + 2 < count; index++) {
+            const UTF8Char byte = current[index];
+            switch ((printf_interprate_class)printf_interprate_class_table[byte]) {
+                case printf_interprate_class_flag:
+                case printf_interprate_class_zero:
+                case printf_interprate_class_digit:
+                case printf_interprate_class_dot:
+                    store[index] = byte;
+                    break;
+                case printf_interprate_class_specifier:
+                    if(!printf_specifier_type_is_floating_point_inline(printf_interprate_check_specifier_byte_inline(byte)) ||
+                       current[index + 1] != CHARACTER_null) DEVELOP_BREAKPOINT_RETURN(false);
+                    store[0] = CHARACTER_percentage;
+                    store[index] = length;
+                    store[index + 1] = byte;
+                    store[index + 2] = CHARACTER_null;
+                    return true;
+                default: DEVELOP_BREAKPOINT_RETURN(false);
+            }
+        }
+    } DEBUG_ELSE
+    return false;
+}
+
+/*!
+    @function printf_snprintf_uncached
+    @abstract CA_snprintf without format cache, for format not address-stable
+ */
+static int printf_snprintf_uncached(char * _Nullable store, size_t n, const char * _Nonnull format, ... ) {
+    if(format != NULL) {
+        printf_core_t data; printf_core_ref core = &data;
+        core->type = printf_type_string;
+        core->format = (const UTF8Char *)format;
+        va_list ap;
+        va_start(ap, format);
+        va_copy(core->args, ap);
+#ifdef DEBUG
+        va_copy(core->original_args, ap);
+        core->original_format = (const UTF8Char *)format;
+#endif
+        core->output.string.count = n;
+        core->output.string.index = 0;
+        core->actual_need = 0;
+        core->output.string.store = (UTF8Char *)store;
+        int rt = printf_internal(core);
+        va_end(ap);
+        va_end(core->args);
+#ifdef DEBUG
+        va_end(core->original_args);
+#endif
+        return rt;
+    }
+    DEVELOP_BREAKPOINT_RETURN(PRINTF_ERROR_RETURN);
+}
+
+int CA_format_float(char * _Nullable store, size_t n, float value, const char * _Nonnull format) {
+    UTF8Char rewrite[PRINTF_FLOATING_POINT_VALUE_FORMAT_SIZE];
+    if(printf_floating_point_value_format(format, CHARACTER_h, rewrite, ARRAY_SIZE(rewrite)))
+        return printf_snprintf_uncached(store, n, (const char *)rewrite, (double)value);
+    // same as CA_snprintf, store is always terminated
+    if(store != NULL && n > 0) store[0] = CHARACTER_null;
+    DEVELOP_BREAKPOINT_RETURN(PRINTF_ERROR_RETURN);
+}
+
+#ifdef PRINTF_FLOATING_POINT_128
+
+int CA_format_float128(char * _Nullable store, size_t n, __float128 value, const char * _Nonnull format) {
+    UTF8Char rewrite[PRINTF_FLOATING_POINT_VALUE_FORMAT_SIZE];
+    if(printf_floating_point_value_format(format, CHARACTER_Q, rewrite, ARRAY_SIZE(rewrite)))
+        return printf_snprintf_uncached(store, n, (const char *)rewrite, value);
+    // same as CA_snprintf, store is always terminated
+    if(store != NULL && n > 0) store[0] = CHARACTER_null;
+    DEVELOP_BREAKPOINT_RETURN(PRINTF_ERROR_RETURN);
+}
+
+#endif
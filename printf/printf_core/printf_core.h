@@ -56,6 +56,58 @@ int CA_fprintf(FILE * _Nonnull fp, const char * _Nonnull format, ...) FPRINTF_AT
 
 int CA_printf(const char * _Nonnull format, ...) PRINTF_ATTR;
 
+#pragma mark - Compiled Format
+
+/*!
+    @typedef CA_format_t
+    @abstract an immutable program compiled from a printf format, parsed only once
+    @discussion safe to be shared by threads, format string is copied and not needed after compiled
+*/
+typedef struct CA_format CA_format_t;
+
+typedef const CA_format_t * CA_format_ref;
+
+/*!
+    @function CA_format_compile
+    @return NULL if the format is not valid or memory allocation failed, use CA_format_release to free
+*/
+CA_format_ref _Nullable CA_format_compile(const char * _Nonnull format);
+
+void CA_format_release(CA_format_ref _Nullable program);
+
+int CA_snprintf_compiled(char * _Nullable store, size_t n, CA_format_ref _Nonnull program, ...);
+
+int CA_fprintf_compiled(FILE * _Nonnull fp, CA_format_ref _Nonnull program, ...);
+
+/*!
+    @function CA_format_cache_statistics
+    @abstract query format cache counters used by CA_snprintf, CA_fprintf and CA_printf
+    @discussion both are zero if format cache is disabled when building
+*/
+void CA_format_cache_statistics(size_t * _Nullable hit, size_t * _Nullable miss);
+
+#pragma mark - Floating Point Value
+
+/*!
+    @function CA_format_float
+    @abstract same as CA_snprintf with [h] length, binary 32 value is formatted as binary 32 instead of binary 64
+    @param format one [fFeEgGaA] conversion with flags, width and precision but no length, such as "%.3e"
+    @return negative if format is not one such conversion
+*/
+int CA_format_float(char * _Nullable store, size_t n, float value, const char * _Nonnull format);
+
+#if defined __SIZEOF_FLOAT128__ && defined __SIZEOF_INT128__
+
+/*!
+    @function CA_format_float128
+    @abstract same as CA_snprintf with [Q] length, for binary 128 value
+    @param format one [fFeEgGaA] conversion with flags, width and precision but no length, such as "%.30e"
+    @return negative if format is not one such conversion
+*/
+int CA_format_float128(char * _Nullable store, size_t n, __float128 value, const char * _Nonnull format);
+
+#endif
+
 #ifdef DEBUG
 
 #endif
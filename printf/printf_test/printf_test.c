@@ -38,6 +38,7 @@
 #include <string.h>
 #include <locale.h>
 #include <limits.h>
+#include <stdint.h>
 #include <float.h>
 #include <time.h>
 #include <math.h>
@@ -56,6 +57,9 @@ static void strict_test(void);
 static void speed_test(void);
 static void gnuc_test(void);
 static void n_test(void);
+static void compiled_test(void);
+static void file_test(void);
+static void random_test(void);
 
 void printf_test(void) {
     setlocale(LC_CTYPE, "zh_CN");
@@ -64,16 +68,28 @@ void printf_test(void) {
     speed_test();
     gnuc_test();
     n_test();
+    compiled_test();
+    file_test();
+    random_test();
     DEBUG_POINT;        // test passed
 }
 
 #define TEST_SAME(format, ...) do {                                             \
     fprintf(stdout, " [FORMAT] %s\n", format);                                  \
-    int rt1 = snprintf(arr, ARRAY_SIZE(arr), format, ## __VA_ARGS__);           \
-    fprintf(stdout, " SYS[%2d]: %s\n", rt1, arr);                               \
+    char expect[ARRAY_SIZE(arr)];                                               \
+    int rt1 = snprintf(expect, ARRAY_SIZE(expect), format, ## __VA_ARGS__);     \
+    fprintf(stdout, " SYS[%2d]: %s\n", rt1, expect);                            \
     int rt2 = CA_snprintf(arr, ARRAY_SIZE(arr), format, ## __VA_ARGS__);        \
     fprintf(stdout, "USER[%2d]: %s\n", rt2, arr);                               \
-    DEBUG_ASSERT(rt1 == rt2); } while(0)
+    DEBUG_ASSERT(rt1 == rt2 && strcmp(expect, arr) == 0); } while(0)
+
+#define TEST_FLOAT(format, value) do {                                          \
+    fprintf(stdout, " [FORMAT] %s\n", format);                                  \
+    int rt1 = snprintf(arr, ARRAY_SIZE(arr), format, (double)(value));          \
+    fprintf(stdout, " SYS[%2d]: %s\n", rt1, arr);                               \
+    int rt2 = CA_format_float(wide, ARRAY_SIZE(wide), value, format);           \
+    fprintf(stdout, "USER[%2d]: %s\n", rt2, wide);                              \
+    DEBUG_ASSERT(rt1 == rt2 && strcmp(arr, wide) == 0); } while(0)
 
 #define SHOW_DIFF(format, ...) do {                                             \
     fprintf(stdout, "[FORMAT] %s\n", format);                                   \
@@ -92,6 +108,15 @@ static void correct_test(void) {
     INFO("mixed");
     TEST_SAME("%0#12.3X", 0x123456);
     TEST_SAME("%-012f", 123.123);
+    INFO("integer");
+    TEST_SAME("%8d|%-8d|%+d|% d|%+8i", 42, -42, 42, 42, -7);
+    TEST_SAME("%#o|%#x|%#X|%#o|%#x", 8, 255, 255, 0, 0);
+    TEST_SAME("%08d|%08x|%-08d|%+08d|%#010x", -42, 0xbeef, 42, 42, 0xbeef);
+    TEST_SAME("%08.3d|%8.5x|%.3o", 42, 0xab, 8);
+    TEST_SAME("[%.0d|%.0x|%#.0o|%5.0d|%-3.0u]", 0, 0, 0, 0, 0);
+    TEST_SAME("%jd|%30jd|%-30jd|", INTMAX_MIN, INTMAX_MIN, INTMAX_MIN);
+    TEST_SAME("%ju|%jx|%#jo", UINTMAX_MAX, UINTMAX_MAX, UINTMAX_MAX);
+    TEST_SAME("%hhd|%hd|%ld|%lld", SCHAR_MIN, SHRT_MIN, LONG_MIN, LLONG_MIN);
     INFO("g specifier");
     TEST_SAME("%.6g", 0.1200001);
     TEST_SAME("%.6g", 0.01299989999999);
@@ -108,8 +133,16 @@ static void correct_test(void) {
     INFO("specifier a");
     TEST_SAME("%050a", 0x1.234p+0);
     TEST_SAME("%20A", -0x1.2345p+0);
+    INFO("specifier a [ rounded to precision, ties to even ]");
+    TEST_SAME("%.0a|%.0a|%.1a|%#.0a|%.3a", 1.5, 2.5, 0x1.f8p+0, 1.0, 0x1.fff8p+0);
+    TEST_SAME("%.8A|%.29a|%.4a", 0x1.3c22ba385p+22, 4.0, -0x1.e8868p-921);
+    TEST_SAME("%a|%.3a|%.0a", 5e-324, 0x1.fffp-1030, 0x0.8p-1022);
+    INFO("g specifier [ # keeps trailing zero ]");
+    TEST_SAME("%#.8G|%#g|%#.3g|%#g", 310.0, 1e70, 0.000123, 123.0);
     TEST_SAME("%p", (void *)0x12345);
-    TEST_SAME("%20p", (void *)0);
+    SHOW_DIFF("%20p", (void *)0);     // glibc prints (nil)
+    int rt = CA_snprintf(arr, ARRAY_SIZE(arr), "%p|%-6p|%5p", (void *)0, (void *)0, (void *)0);
+    DEBUG_ASSERT(rt == 16 && strcmp(arr, "0x0|0x0   |  0x0") == 0);
     TEST_SAME("%20%");
     TEST_SAME("%s", "我爱你中国");
     SHOW_DIFF("%.4s", "我爱你中国");
@@ -122,6 +155,7 @@ static void correct_test(void) {
     TEST_SAME("%6.12g", 0.0);
     TEST_SAME("%a", 0.0);
     TEST_SAME("%12.3a", 0.0);
+    TEST_SAME("%#g|%#.0g|%#10.3G|%012a|%-#12a|", 0.0, 0.0, -0.0, 0.0, -0.0);
     TEST_SAME("%f", -0.0);
     TEST_SAME("%-#12.0f", -0.0);
     TEST_SAME("%e", -0.0);
@@ -130,6 +164,67 @@ static void correct_test(void) {
     TEST_SAME("%a", -0.0);
     TEST_SAME("%12.3a", -0.0);
     TEST_SAME("%.70f", 2333333333333333);
+    INFO("precision beyond 1024 [ scratch arena ]");
+    TEST_SAME("%.2000f", 0.5);
+    TEST_SAME("%.1500e", 0.5);
+    INFO("decimal exponent estimate [ power of ten ]");
+    TEST_SAME("%.20e|%g|%.3e", 1e300, 1e-300, 9.999999999999999e-301);
+    TEST_SAME("%.20e|%g|%.3e", 1e22, 1e-5, 9.5e-300);
+    INFO("fixed precision [ rounded from exact value ]");
+    TEST_SAME("%.2f|%.2f|%.0f|%.3f", 2.675, 0.125, 2.5, 999.9995);
+    TEST_SAME("%.17e|%.3e|%.0e|%e", 0.1, 9.9995, 5e-324, 2.2250738585072014e-308);
+    INFO("beyond 17 digits [ exact digits, not zero padded ]");
+    TEST_SAME("%.25e|%.30f", 0.1, 1e-10);
+    TEST_SAME("%.20g|%.24g|%.19e", 2.0 / 3, 1e23, 0x1.fffffffffffffp+1023);
+    TEST_SAME("%.40e|%.0f", 0x1p-1074, 1e300);
+    INFO("fixed precision beyond 64 bit [ exact integer part ]");
+    TEST_SAME("%.14f|%.16f", 359330642406323.375, 0x1.027e72f1f1281p+93);
+    TEST_SAME("%.17f|%.3f|%.1f", 0x1.fffffffffffffp+63, 1e20, 123456789012345678.0);
+    TEST_SAME("%.10f|%.5e", 0x1.5p+120, 0x1.5p+120);
+    INFO("long double [ 80 bit extended precision ]");
+    TEST_SAME("%Le|%.17Le|%.3LE", 0x1.fffffffffffffffep+16383L, 1.1L, 0x1p-16445L);
+    TEST_SAME("%.0Le|%.10Le|%Lf", 0.1L, -0x1p-16382L, 1.1L);
+    TEST_SAME("%.18LE|%.20Le|%.21Le", -0xf.77af72015d86aabp+4L, 0x1.fffffffffffffffep+63L, 1.1L);
+    TEST_SAME("%.20Lf|%.21Lf|%.3Lf", 0x1.8p+50L, 1.1L, 0x1.23456789abcdef1p+60L);
+    TEST_SAME("%.21Lg|%.19Lg|%.25Lg", 123456789012345.678L, 0x1.fffffffffffffffep+62L, 1e-30L);
+    INFO("binary 32 [ h length, CA_format_float ]");
+    char wide[100];
+    TEST_FLOAT("%e", 0.1f);
+    TEST_FLOAT("%.9g", 0.1f);
+    TEST_FLOAT("%.17g", 0.1f);
+    TEST_FLOAT("%.20e", 0.1f);
+    TEST_FLOAT("%.25f", 0.1f);
+    TEST_FLOAT("%.3E", -3.4028235e38f);
+    TEST_FLOAT("%.60e", 0x1p-149f);
+    TEST_FLOAT("%.2f", 0.125f);
+    rt = CA_format_float(arr, ARRAY_SIZE(arr), 0.1f, "%.12g");
+    DEBUG_ASSERT(rt == 13 && strcmp(arr, "0.10000000149") == 0);    // exact value, trailing zero removed by g
+    // h on floating conversion is not C, format is not a literal for the format check
+    const char *length_h = "%.9hg|%.20he|%hf";
+    rt = CA_snprintf(arr, ARRAY_SIZE(arr), length_h, 0.1f, 0x1.fffffep-126f, 1e-3f);
+    DEBUG_ASSERT(rt == snprintf(wide, ARRAY_SIZE(wide), "%.9g|%.20e|%f", (double)0.1f, (double)0x1.fffffep-126f, (double)1e-3f));
+    DEBUG_ASSERT(strcmp(arr, wide) == 0);
+    DEBUG_ASSERT(CA_format_float(arr, ARRAY_SIZE(arr), 1, "%.2d") == -1 && arr[0] == 0);
+#if defined __SIZEOF_FLOAT128__ && defined __SIZEOF_INT128__
+    INFO("binary 128 [ CA_format_float128 ]");
+    char quad[100];
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), (__float128)0.1, "%.17e");
+    DEBUG_ASSERT(rt == CA_snprintf(arr, ARRAY_SIZE(arr), "%.17e", 0.1) && strcmp(quad, arr) == 0);
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), (__float128)-0x1.8p-1000, "%-12.3E");
+    DEBUG_ASSERT(rt == CA_snprintf(arr, ARRAY_SIZE(arr), "%-12.3E", -0x1.8p-1000) && strcmp(quad, arr) == 0);
+    DEBUG_ASSERT(CA_format_float128(quad, ARRAY_SIZE(quad), 1, "%d") == -1 && quad[0] == 0);
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), 4, "%.29a");
+    DEBUG_ASSERT(rt == 36 && strcmp(quad, "0x1.00000000000000000000000000000p+2") == 0);
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), 310, "%#.8G");
+    DEBUG_ASSERT(rt == 9 && strcmp(quad, "310.00000") == 0);
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), (__float128)0x1.878dda12e6fdap-152 + 0x1.cp-206, "%.10a");
+    DEBUG_ASSERT(rt == 19 && strcmp(quad, "0x1.878dda12e7p-152") == 0);
+    // exact digits past the fast paths
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), (__float128)DBL_MAX * DBL_MAX, "%.40e");
+    DEBUG_ASSERT(rt == 47 && strcmp(quad, "3.2317006071311000124898031224579573843091e+616") == 0);
+    rt = CA_format_float128(quad, ARRAY_SIZE(quad), (__float128)1 / 10, "%.40f");
+    DEBUG_ASSERT(rt == 42 && strcmp(quad, "0.1000000000000000000000000000000000048148") == 0);
+#endif
     TEST_SAME("%ls", L"我爱你中国");
     SHOW_DIFF("%.4ls", L"我爱你中国");
     SHOW_DIFF("%20ls", L"亲爱的母亲, 我为你流泪, 也为你自豪");
@@ -228,6 +323,9 @@ static void gnuc_test(void) {
     TEST_SAME("%g should be 1e+06\n", 1000000.0);
     TEST_SAME("%g should be 10\n", 10.0);
     TEST_SAME("%g should be 0.02\n", 0.02);
+    TEST_SAME("%e should be 1.000000e+23\n", 1e23);
+    TEST_SAME("%.0e should be 1e+01\n", 9.7);
+    TEST_SAME("%e should be 1.234568e+46\n", 1.2345678e46);
     TEST_SAME("%Le\n", 0x1p-1022L);
     TEST_SAME("%Le\n", 0x1.0000000000001p-1022L);
     TEST_SAME("%Le\n", 0x1.00000000001e7p-1022L);
@@ -265,6 +363,104 @@ static void n_test(void) {
     DEBUG_ASSERT(rt1 == rt2);
 }
 
+#define TEST_COMPILED(format, ...) do {                                         \
+    fprintf(stdout, " [FORMAT] %s\n", format);                                  \
+    int rt1 = CA_snprintf(arr1, ARRAY_SIZE(arr1), format, ## __VA_ARGS__);      \
+    CA_format_ref program = CA_format_compile(format);                          \
+    DEBUG_ASSERT(program != NULL);                                              \
+    int rt2 = CA_snprintf_compiled(arr2, ARRAY_SIZE(arr2), program, ## __VA_ARGS__); \
+    fprintf(stdout, "USER[%2d]: %s\n", rt2, arr2);                              \
+    CA_format_release(program);                                                 \
+    DEBUG_ASSERT(rt1 == rt2 && strcmp(arr1, arr2) == 0); } while(0)
+
+static void compiled_test(void) {
+    char arr1[100]; char arr2[100];
+    INFO("compiled format");
+    TEST_COMPILED("plain literal only");
+    TEST_COMPILED("%d|%-8s|%08.3f|%x", -42, "str", 3.14159, 0xbeef);
+    TEST_COMPILED("%*d|%-*.*s|%%", 6, 12, 8, 3, "abcdef");
+    TEST_COMPILED("%e %g %a", 1e-7, 123456789.0, 1.5);
+    DEBUG_ASSERT(CA_format_compile("broken %") == NULL);
+    INFO("UTF8 format");
+    TEST_COMPILED("caf\xc3\xa9 %d \xe2\x82\xac", 42);
+    DEBUG_ASSERT(CA_format_compile("%d \xc3") == NULL);
+    DEBUG_ASSERT(CA_snprintf(arr1, ARRAY_SIZE(arr1), "%d \xe2\x82%d", 1, 2) == -1);
+    INFO("format cache");
+    char format[16] = "%d-%d";
+    size_t hit, miss, hit_after, miss_after;
+    CA_format_cache_statistics(&hit, &miss);
+    CA_snprintf(arr1, ARRAY_SIZE(arr1), format, 1, 2);     // miss, address marked
+    CA_snprintf(arr1, ARRAY_SIZE(arr1), format, 3, 4);     // miss, slot filled
+    CA_snprintf(arr1, ARRAY_SIZE(arr1), format, 5, 6);
+    CA_format_cache_statistics(&hit_after, &miss_after);
+    DEBUG_ASSERT(strcmp(arr1, "5-6") == 0);
+    DEBUG_ASSERT(hit_after + miss_after == 0 || (hit_after - hit == 1 && miss_after - miss == 2));
+    strcpy(format, "%d+%d");    // same buffer, same length, different content
+    CA_snprintf(arr1, ARRAY_SIZE(arr1), format, 7, 8);
+    DEBUG_ASSERT(strcmp(arr1, "7+8") == 0);
+    CA_snprintf(arr1, ARRAY_SIZE(arr1), format, 9, 10);
+    DEBUG_ASSERT(strcmp(arr1, "9+10") == 0);
+    CA_snprintf(arr1, ARRAY_SIZE(arr1), format, 11, 12);
+    DEBUG_ASSERT(strcmp(arr1, "11+12") == 0);
+    CA_format_cache_statistics(&hit_after, &miss_after);
+    DEBUG_ASSERT(hit_after + miss_after == 0 || (hit_after - hit == 2 && miss_after - miss == 4));
+}
+
+static void file_test(void) {
+    static char line[1800]; static char expect[4096]; static char actual[4096];
+    INFO("file output");
+    memset(line, 'x', sizeof(line) - 1);
+    FILE *fp = tmpfile();
+    DEBUG_ASSERT(fp != NULL);
+    if(fp == NULL) return;
+    int rt1 = snprintf(expect, ARRAY_SIZE(expect), "%s|%1500d|%-8.3f|", line, -42, 3.14159);
+    int rt2 = CA_fprintf(fp, "%s|%1500d|%-8.3f|", line, -42, 3.14159);
+    DEBUG_ASSERT(rt1 > 1024 && rt2 >= 0);       // longer than the file staging buffer
+    rewind(fp);
+    size_t count = fread(actual, 1, ARRAY_SIZE(actual), fp);
+    DEBUG_ASSERT(count == (size_t)rt1 && memcmp(actual, expect, count) == 0);
+    
+    rewind(fp);
+    DEBUG_ASSERT(CA_fprintf(fp, "%d broken %", 42) < 0);
+    DEBUG_ASSERT(CA_fprintf(fp, "%s broken %", line) < 0);     // spilled before the bad specifier
+    fflush(fp);
+    DEBUG_ASSERT(ftell(fp) == 0);       // nothing written on invalid format
+    fclose(fp);
+}
+
+static void random_test(void) {
+    static char expect[512]; static char actual[512];
+    static const char flags[] = "-+ 0#";
+    static const char specifiers[] = "eEfFgGaA";
+    uint64_t state = UINT64_C(0x9E3779B97F4A7C15);      // fixed seed, same cases every run
+    long bad = 0;
+    INFO("random floating point against snprintf");
+    for(int index = 0; index < 20000; index++) {
+        // xorshift 64
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        uint64_t bits = state;
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if(!isfinite(value)) continue;
+        
+        char format[16];
+        char *cursor = format;
+        *cursor++ = '%';
+        for(int flag = 0; flag < 5; flag++)
+            if((state >> flag) & 1) *cursor++ = flags[flag];
+        snprintf(cursor, ARRAY_SIZE(format) - (size_t)(cursor - format), "%d.%d%c",
+                 (int)((state >> 8) % 40), (int)((state >> 16) % 40), specifiers[(state >> 24) % 8]);
+        
+        int rt1 = snprintf(expect, ARRAY_SIZE(expect), format, value);
+        int rt2 = CA_snprintf(actual, ARRAY_SIZE(actual), format, value);
+        if(rt1 != rt2 || strcmp(expect, actual) != 0) {
+            if(bad++ < 8) fprintf(stdout, "[FORMAT] %s %a\n SYS[%2d]: %s\nUSER[%2d]: %s\n", format, value, rt1, expect, rt2, actual);
+        }
+    }
+    DEBUG_ASSERT(bad == 0);
+}
+
 CLANG_DIAGNOSTIC_POP
 
 #endif
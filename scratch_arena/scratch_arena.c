@@ -0,0 +1,283 @@
+/*
+* Created by Bill Sun. All rights reserved.
+*
+* Email: captainallredbillball@gmail.com
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+* 3. All advertising materials mentioning features or use of this software
+*    must display the following acknowledgement:
+*    This product includes software developed by Bill Sun
+* 4. The name of the Author must not be used to endorse or promote products
+*    derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS ``AS IS'' AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+* OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+* OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+* SUCH DAMAGE.
+*
+*    scratch_arena.c 2026/10/17
+*/
+
+/*!
+    @header scratch_arena.c
+    @abstract each thread owns a chain of heap blocks or one supplied buffer, a mark is the
+              position counted from the first byte of the first block
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "CFMacro.h"
+#include "scratch_arena.h"
+
+#if defined __unix__ || defined __APPLE__
+  #define SCRATCH_ARENA_PTHREAD
+  #include <pthread.h>
+#endif
+
+COMILE_ASSERT((SCRATCH_ARENA_ALIGNMENT & (SCRATCH_ARENA_ALIGNMENT - 1)) == 0);
+
+#pragma mark - Type
+
+/*!
+    @struct scratch_arena_block
+    @abstract heap block, base is the position of data[0]
+ */
+typedef struct scratch_arena_block {
+    struct scratch_arena_block * _Nullable next;
+    size_t base;
+    size_t capacity;
+    size_t used;
+    unsigned char data[];
+} scratch_arena_block_t;
+
+typedef scratch_arena_block_t * scratch_arena_block_ref;
+
+typedef struct scratch_arena_state {
+    scratch_arena_block_ref _Nullable first;
+    scratch_arena_block_ref _Nullable current;      // blocks after current are kept for reuse
+    unsigned char * _Nullable supplied;             // heap blocks are not used if not NULL
+    size_t supplied_capacity;
+    size_t supplied_used;
+    size_t high_water;
+    bool registered;                                // thread exit cleanup registered
+} scratch_arena_state_t;
+
+static _Thread_local scratch_arena_state_t scratch_arena_state;
+
+#pragma mark - Static Declaration
+
+static scratch_arena_block_ref _Nullable scratch_arena_block_create(size_t base, size_t capacity);
+static void scratch_arena_block_chain_free(scratch_arena_block_ref _Nullable block);
+
+/*!
+    @function scratch_arena_padding_inline
+    @return bytes needed before address is aligned
+ */
+static inline size_t scratch_arena_padding_inline(const unsigned char * _Nonnull address) {
+    return (size_t)(- (uintptr_t)address) & (SCRATCH_ARENA_ALIGNMENT - 1);
+}
+
+static inline size_t scratch_arena_position_inline(scratch_arena_state_t * _Nonnull state) {
+    if(state->supplied != NULL) return state->supplied_used;
+    if(state->current == NULL) return 0;
+    return state->current->base + state->current->used;
+}
+
+static inline void scratch_arena_update_high_water_inline(scratch_arena_state_t * _Nonnull state) {
+    size_t position = scratch_arena_position_inline(state);
+    if(position > state->high_water) state->high_water = position;
+}
+
+#pragma mark - Thread Exit
+
+#ifdef SCRATCH_ARENA_PTHREAD
+
+static pthread_key_t scratch_arena_thread_key;
+static pthread_once_t scratch_arena_thread_once = PTHREAD_ONCE_INIT;
+
+static void scratch_arena_thread_exit(void * _Nullable value) {
+    scratch_arena_state_t *state = value;
+    if(state != NULL) {
+        scratch_arena_block_chain_free(state->first);
+        state->first = NULL;
+        state->current = NULL;
+    }
+}
+
+static void scratch_arena_thread_key_create(void) {
+    if(pthread_key_create(&scratch_arena_thread_key, scratch_arena_thread_exit) != 0) DEBUG_POINT;
+}
+
+#endif
+
+/*!
+    @function scratch_arena_register_thread_exit_inline
+    @abstract called when a thread gets its first heap block
+ */
+static inline void scratch_arena_register_thread_exit_inline(scratch_arena_state_t * _Nonnull state) {
+#ifdef SCRATCH_ARENA_PTHREAD
+    if(!state->registered) {
+        pthread_once(&scratch_arena_thread_once, scratch_arena_thread_key_create);
+        state->registered = pthread_setspecific(scratch_arena_thread_key, state) == 0;
+    }
+#endif
+}
+
+#pragma mark - Configuration
+
+bool scratch_arena_reserve(size_t capacity) {
+    scratch_arena_state_t *state = &scratch_arena_state;
+    if(scratch_arena_position_inline(state) != 0) DEBUG_RETURN(false);
+    state->supplied = NULL;
+    if(state->first != NULL && state->first->next == NULL && state->first->capacity >= capacity) return true;
+    scratch_arena_block_chain_free(state->first);
+    state->first = state->current = scratch_arena_block_create(0, capacity);
+    if(state->first == NULL) return false;
+    scratch_arena_register_thread_exit_inline(state);
+    return true;
+}
+
+bool scratch_arena_supply(void * _Nullable buffer, size_t capacity) {
+    scratch_arena_state_t *state = &scratch_arena_state;
+    if(scratch_arena_position_inline(state) != 0) DEBUG_RETURN(false);
+    state->supplied = buffer;
+    state->supplied_capacity = buffer != NULL ? capacity : 0;
+    state->supplied_used = 0;
+    if(buffer != NULL) {
+        // heap blocks are not needed anymore
+        scratch_arena_block_chain_free(state->first);
+        state->first = state->current = NULL;
+    }
+    return true;
+}
+
+void scratch_arena_destroy(void) {
+    scratch_arena_state_t *state = &scratch_arena_state;
+    DEBUG_ASSERT(scratch_arena_position_inline(state) == 0);
+    scratch_arena_block_chain_free(state->first);
+    state->first = state->current = NULL;
+}
+
+#pragma mark - Allocation
+
+void * _Nullable scratch_arena_alloc(size_t size) {
+    scratch_arena_state_t *state = &scratch_arena_state;
+    
+    if(state->supplied != NULL) {
+        size_t padding = scratch_arena_padding_inline(state->supplied + state->supplied_used);
+        size_t remain = state->supplied_capacity - state->supplied_used;
+        if(padding > remain || size > remain - padding) return NULL;
+        void *result = state->supplied + state->supplied_used + padding;
+        state->supplied_used += padding + size;
+        scratch_arena_update_high_water_inline(state);
+        return result;
+    }
+    
+    // enough for any padding
+    if(size > SIZE_MAX - SCRATCH_ARENA_ALIGNMENT) return NULL;
+    size_t need = size + SCRATCH_ARENA_ALIGNMENT - 1;
+    
+    if(state->current == NULL) {
+        if(state->first == NULL) {
+            state->first = scratch_arena_block_create(0, need > SCRATCH_ARENA_DEFAULT_CAPACITY ? need : SCRATCH_ARENA_DEFAULT_CAPACITY);
+            if(state->first == NULL) return NULL;
+            scratch_arena_register_thread_exit_inline(state);
+        }
+        state->current = state->first;
+        state->current->used = 0;
+    }
+    
+    scratch_arena_block_ref block = state->current;
+    if(block->capacity - block->used < need) {
+        scratch_arena_block_ref next = block->next;
+        if(next == NULL || next->capacity < need) {
+            // kept block too small, replaced by one doubled
+            scratch_arena_block_chain_free(next);
+            size_t capacity = block->capacity * 2 > need ? block->capacity * 2 : need;
+            next = scratch_arena_block_create(block->base + block->capacity, capacity);
+            block->next = next;
+            if(next == NULL) return NULL;
+        }
+        next->used = 0;
+        state->current = block = next;
+    }
+    
+    size_t padding = scratch_arena_padding_inline(block->data + block->used);
+    void *result = block->data + block->used + padding;
+    block->used += padding + size;
+    scratch_arena_update_high_water_inline(state);
+    return result;
+}
+
+size_t scratch_arena_mark(void) {
+    return scratch_arena_position_inline(&scratch_arena_state);
+}
+
+void scratch_arena_release(size_t mark) {
+    scratch_arena_state_t *state = &scratch_arena_state;
+    DEBUG_ASSERT(mark <= scratch_arena_position_inline(state));
+    
+    if(state->supplied != NULL) {
+        if(mark <= state->supplied_used) state->supplied_used = mark;
+        return;
+    }
+    
+    if(state->first == NULL) return;
+    
+    if(mark == 0 && state->first->next != NULL) {
+        // merge blocks, next round fits in one
+        size_t capacity = state->high_water + SCRATCH_ARENA_ALIGNMENT;
+        scratch_arena_block_chain_free(state->first);
+        state->first = state->current = scratch_arena_block_create(0, capacity);
+        return;
+    }
+    
+    scratch_arena_block_ref block = state->first;
+    while(block->next != NULL && mark > block->base + block->capacity) block = block->next;
+    DEBUG_ASSERT(mark >= block->base && mark <= block->base + block->capacity);
+    if(mark < block->base) mark = block->base;
+    block->used = mark - block->base;
+    state->current = block;
+}
+
+#pragma mark - Statistics
+
+size_t scratch_arena_high_water(void) {
+    return scratch_arena_state.high_water;
+}
+
+#pragma mark - Static Definition
+
+static scratch_arena_block_ref _Nullable scratch_arena_block_create(size_t base, size_t capacity) {
+    if(capacity > SIZE_MAX - sizeof(scratch_arena_block_t)) return NULL;
+    scratch_arena_block_ref block = malloc(sizeof(scratch_arena_block_t) + capacity);
+    if(block != NULL) {
+        block->next = NULL;
+        block->base = base;
+        block->capacity = capacity;
+        block->used = 0;
+    }
+    return block;
+}
+
+static void scratch_arena_block_chain_free(scratch_arena_block_ref _Nullable block) {
+    while(block != NULL) {
+        scratch_arena_block_ref next = block->next;
+        free(block);
+        block = next;
+    }
+}
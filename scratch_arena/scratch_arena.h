@@ -0,0 +1,144 @@
+/*
+* Created by Bill Sun. All rights reserved.
+*
+* Email: captainallredbillball@gmail.com
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+* 3. All advertising materials mentioning features or use of this software
+*    must display the following acknowledgement:
+*    This product includes software developed by Bill Sun
+* 4. The name of the Author must not be used to endorse or promote products
+*    derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS ``AS IS'' AND
+* ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+* OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+* OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+* SUCH DAMAGE.
+*
+*    scratch_arena.h 2026/10/17
+*/
+
+/*!
+    @header scratch_arena.h
+ 
+    This header file describes a per thread bump allocator for temporary storage,
+    allocation is released by restoring a mark instead of freeing each block
+ */
+
+#ifndef scratch_arena_h
+#define scratch_arena_h
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#pragma mark - Basic Info
+
+#pragma mark Behaviour Control
+
+/*!
+    @name SCRATCH_ARENA_DEFAULT_CAPACITY
+    @discussion bytes of the first heap block of a thread, allocated at the first use
+    @author you may choose to change it
+ */
+#define SCRATCH_ARENA_DEFAULT_CAPACITY  16384
+
+/*!
+    @name SCRATCH_ARENA_ALIGNMENT
+    @discussion every allocation is aligned to it, should be power of 2
+ */
+#define SCRATCH_ARENA_ALIGNMENT         16
+
+#pragma mark Scope Macro
+
+/*!
+    @name SCRATCH_ARENA_SCOPE
+    @abstract allocation after it is released when leaving the enclosing block
+    @discussion only available for GNUC, use scratch_arena_mark and scratch_arena_release otherwise
+ */
+#ifdef __GNUC__
+#define SCRATCH_ARENA_SCOPE \
+        size_t scratch_arena_scope_mark __attribute__((cleanup(scratch_arena_scope_release))) = scratch_arena_mark()
+#endif
+
+#pragma mark - Configuration
+
+/*!
+    @function scratch_arena_reserve
+    @abstract make the heap block of calling thread hold at least capacity bytes
+    @discussion only valid when nothing is allocated, a supplied buffer is dropped
+    @return false if anything is allocated or heap allocation failed
+ */
+bool scratch_arena_reserve(size_t capacity);
+
+/*!
+    @function scratch_arena_supply
+    @abstract use buffer as storage of calling thread, heap is never used until supplied NULL
+    @discussion only valid when nothing is allocated, buffer should outlive its use,
+                allocation more than capacity fails instead of growing
+    @param buffer NULL to go back to heap blocks
+    @return false if anything is allocated
+ */
+bool scratch_arena_supply(void * _Nullable buffer, size_t capacity);
+
+/*!
+    @function scratch_arena_destroy
+    @abstract free heap blocks of calling thread
+    @discussion heap blocks are also freed at thread exit if pthread is available
+ */
+void scratch_arena_destroy(void);
+
+#pragma mark - Allocation
+
+/*!
+    @function scratch_arena_alloc
+    @abstract allocate size bytes aligned to SCRATCH_ARENA_ALIGNMENT from calling thread
+    @discussion heap storage grows by another block when the current one is full
+    @return NULL if supplied buffer is full or heap allocation failed
+ */
+void * _Nullable scratch_arena_alloc(size_t size);
+
+/*!
+    @function scratch_arena_mark
+    @return current position, pass to scratch_arena_release to free everything allocated after
+ */
+size_t scratch_arena_mark(void);
+
+/*!
+    @function scratch_arena_release
+    @abstract free everything allocated after mark, heap blocks are kept for reuse
+    @discussion when released to zero, more than one heap block are merged into one
+                large enough for the high water mark
+ */
+void scratch_arena_release(size_t mark);
+
+/*!
+    @function scratch_arena_scope_release
+    @abstract cleanup function of SCRATCH_ARENA_SCOPE
+ */
+static inline void scratch_arena_scope_release(size_t * _Nonnull mark) {
+    scratch_arena_release(mark[0]);
+}
+
+#pragma mark - Statistics
+
+/*!
+    @function scratch_arena_high_water
+    @return most bytes ever in use at the same time by calling thread, alignment padding included
+ */
+size_t scratch_arena_high_water(void);
+
+#endif /* scratch_arena_h */